@@ -27,6 +27,15 @@
 
 namespace brave_ads {
 
+namespace {
+
+// Text classification only needs a sample of the page, so cap the text before
+// it is copied out of the renderer and over to the ads process.
+constexpr char kTextSampleScript[] =
+    "document?.body?.innerText?.substring(0, 65536)";
+
+}  // namespace
+
 AdsTabHelper::AdsTabHelper(content::WebContents* web_contents)
     : WebContentsObserver(web_contents),
       tab_id_(sessions::SessionTabHelper::IdForTab(web_contents)),
@@ -77,13 +86,19 @@ void AdsTabHelper::RunIsolatedJavaScript(
     content::RenderFrameHost* render_frame_host) {
   DCHECK(render_frame_host);
 
+  // Ads ignore anything but http(s) pages, so don't serialize the DOM for them
+  if (redirect_chain_.empty() ||
+      !redirect_chain_.back().SchemeIsHTTPOrHTTPS()) {
+    return;
+  }
+
   dom_distiller::RunIsolatedJavaScript(
       render_frame_host, "new XMLSerializer().serializeToString(document)",
       base::BindOnce(&AdsTabHelper::OnJavaScriptHtmlResult,
                      weak_factory_.GetWeakPtr()));
 
   dom_distiller::RunIsolatedJavaScript(
-      render_frame_host, "document?.body?.innerText",
+      render_frame_host, kTextSampleScript,
       base::BindOnce(&AdsTabHelper::OnJavaScriptTextResult,
                      weak_factory_.GetWeakPtr()));
 }
@@ -5,9 +5,14 @@
 
 #include "brave/browser/brave_wallet/brave_wallet_service_factory.h"
 
+#include <utility>
+
+#include "base/memory/scoped_refptr.h"
+#include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_service.h"
 #include "chrome/browser/profiles/incognito_helpers.h"
 #include "components/keyed_service/content/browser_context_dependency_manager.h"
+#include "components/prefs/json_pref_store.h"
 #include "components/user_prefs/user_prefs.h"
 #include "content/public/browser/browser_context.h"
 #include "content/public/browser/storage_partition.h"
@@ -40,7 +45,10 @@ KeyedService* BraveWalletServiceFactory::BuildServiceInstanceFor(
   auto* default_storage_partition = context->GetDefaultStoragePartition();
   auto shared_url_loader_factory =
       default_storage_partition->GetURLLoaderFactoryForBrowserProcess();
+  auto tx_store = base::MakeRefCounted<JsonPrefStore>(
+      context->GetPath().AppendASCII(kTransactionsFileName));
   return new BraveWalletService(user_prefs::UserPrefs::Get(context),
+                                std::move(tx_store),
                                 shared_url_loader_factory);
 }
 
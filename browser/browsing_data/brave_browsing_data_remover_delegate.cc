@@ -10,6 +10,7 @@
 
 #include "brave/components/content_settings/core/browser/brave_content_settings_pref_provider.h"
 #include "brave/components/content_settings/core/browser/brave_content_settings_utils.h"
+#include "brave/components/greaselion/browser/buildflags/buildflags.h"
 #include "chrome/browser/browsing_data/chrome_browsing_data_remover_constants.h"
 #include "chrome/browser/content_settings/host_content_settings_map_factory.h"
 #include "chrome/browser/profiles/profile.h"
@@ -21,6 +22,11 @@
 #include "extensions/browser/event_router.h"
 #endif
 
+#if BUILDFLAG(ENABLE_GREASELION)
+#include "brave/browser/greaselion/greaselion_service_factory.h"
+#include "brave/components/greaselion/browser/greaselion_service.h"
+#endif
+
 #if BUILDFLAG(IPFS_ENABLED)
 #include "base/command_line.h"
 #include "base/files/file_path.h"
@@ -68,6 +74,17 @@ void BraveBrowsingDataRemoverDelegate::RemoveEmbedderData(
     ClearIPFSCache();
 #endif
 
+#if BUILDFLAG(ENABLE_GREASELION)
+  // Greaselion persists which rules were requested by navigations, which
+  // reveals the sites that were visited.
+  if (remove_mask & chrome_browsing_data_remover::DATA_TYPE_HISTORY) {
+    auto* greaselion_service =
+        greaselion::GreaselionServiceFactory::GetForBrowserContext(profile_);
+    if (greaselion_service)
+      greaselion_service->ClearRequestedRules();
+  }
+#endif
+
 #if BUILDFLAG(ENABLE_EXTENSIONS)
   if (remove_mask & chrome_browsing_data_remover::DATA_TYPE_HISTORY) {
     auto* event_router = extensions::EventRouter::Get(profile_);
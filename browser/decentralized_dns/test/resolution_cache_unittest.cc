@@ -0,0 +1,158 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/decentralized_dns/resolution_cache.h"
+
+#include <utility>
+#include <vector>
+
+#include "base/bind.h"
+#include "base/test/task_environment.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace decentralized_dns {
+
+class ResolutionCacheUnitTest : public testing::Test {
+ public:
+  ResolutionCacheUnitTest()
+      : task_environment_(base::test::TaskEnvironment::TimeSource::MOCK_TIME) {}
+  ~ResolutionCacheUnitTest() override = default;
+
+  // Stands in for the JSON-RPC controller: counts requests and holds on to
+  // their callbacks until the test answers them.
+  ResolutionCache::StartRequestCallback StartRequest() {
+    return base::BindOnce(
+        [](ResolutionCacheUnitTest* test,
+           ResolutionCache::ResolveCallback callback) {
+          test->request_count_++;
+          test->pending_requests_.push_back(std::move(callback));
+          return true;
+        },
+        base::Unretained(this));
+  }
+
+  ResolutionCache::ResolveCallback CountResponse(std::string* result) {
+    return base::BindOnce(
+        [](ResolutionCacheUnitTest* test, std::string* out, bool success,
+           const std::string& result) {
+          test->response_count_++;
+          *out = result;
+        },
+        base::Unretained(this), result);
+  }
+
+  void AnswerRequests(bool success, const std::string& result) {
+    auto requests = std::move(pending_requests_);
+    for (auto& request : requests)
+      std::move(request).Run(success, result);
+  }
+
+ protected:
+  base::test::TaskEnvironment task_environment_;
+  ResolutionCache cache_;
+  int request_count_ = 0;
+  int response_count_ = 0;
+  std::vector<ResolutionCache::ResolveCallback> pending_requests_;
+};
+
+TEST_F(ResolutionCacheUnitTest, CoalescesConcurrentRequests) {
+  std::string result1, result2;
+  cache_.Resolve("brave.eth", StartRequest(), CountResponse(&result1));
+  cache_.Resolve("brave.eth", StartRequest(), CountResponse(&result2));
+  EXPECT_EQ(1, request_count_);
+  EXPECT_EQ(0, response_count_);
+
+  AnswerRequests(true, "0x1234");
+  EXPECT_EQ(2, response_count_);
+  EXPECT_EQ("0x1234", result1);
+  EXPECT_EQ("0x1234", result2);
+
+  bool success = false;
+  std::string cached;
+  EXPECT_TRUE(cache_.Lookup("brave.eth", &success, &cached));
+  EXPECT_TRUE(success);
+  EXPECT_EQ("0x1234", cached);
+  EXPECT_FALSE(cache_.Lookup("brave.crypto", &success, &cached));
+}
+
+TEST_F(ResolutionCacheUnitTest, EntriesExpire) {
+  std::string result;
+  cache_.Resolve("brave.eth", StartRequest(), CountResponse(&result));
+  AnswerRequests(true, "0x1234");
+  cache_.Resolve("brave.crypto", StartRequest(), CountResponse(&result));
+  AnswerRequests(false, "");
+
+  bool success = true;
+  std::string cached;
+  EXPECT_TRUE(cache_.Lookup("brave.crypto", &success, &cached));
+  EXPECT_FALSE(success);
+
+  task_environment_.FastForwardBy(ResolutionCache::kNegativeTTL);
+  EXPECT_FALSE(cache_.Lookup("brave.crypto", &success, &cached));
+  EXPECT_TRUE(cache_.Lookup("brave.eth", &success, &cached));
+
+  task_environment_.FastForwardBy(ResolutionCache::kPositiveTTL);
+  EXPECT_FALSE(cache_.Lookup("brave.eth", &success, &cached));
+}
+
+TEST_F(ResolutionCacheUnitTest, ClearDropsEntriesAndInFlightResults) {
+  std::string result;
+  cache_.Resolve("brave.eth", StartRequest(), CountResponse(&result));
+  AnswerRequests(true, "0x1234");
+  cache_.Resolve("brave.crypto", StartRequest(), CountResponse(&result));
+  cache_.Clear();
+
+  bool success = false;
+  std::string cached;
+  EXPECT_FALSE(cache_.Lookup("brave.eth", &success, &cached));
+
+  // The request in flight still answers its caller but is not cached.
+  AnswerRequests(true, "0x5678");
+  EXPECT_EQ(2, response_count_);
+  EXPECT_EQ("0x5678", result);
+  EXPECT_FALSE(cache_.Lookup("brave.crypto", &success, &cached));
+}
+
+TEST_F(ResolutionCacheUnitTest, RequestAfterClearDoesNotJoinInFlight) {
+  std::string result1, result2;
+  cache_.Resolve("brave.eth", StartRequest(), CountResponse(&result1));
+  cache_.Clear();
+  cache_.Resolve("brave.eth", StartRequest(), CountResponse(&result2));
+  EXPECT_EQ(2, request_count_);
+
+  // Each caller gets the answer of its own request, and only the request
+  // issued after the clear is cached.
+  auto requests = std::move(pending_requests_);
+  std::move(requests[0]).Run(true, "0x1234");
+  EXPECT_EQ(1, response_count_);
+  EXPECT_EQ("0x1234", result1);
+  EXPECT_EQ("", result2);
+
+  bool success = false;
+  std::string cached;
+  EXPECT_FALSE(cache_.Lookup("brave.eth", &success, &cached));
+
+  std::move(requests[1]).Run(true, "0x5678");
+  EXPECT_EQ(2, response_count_);
+  EXPECT_EQ("0x5678", result2);
+  EXPECT_TRUE(cache_.Lookup("brave.eth", &success, &cached));
+  EXPECT_EQ("0x5678", cached);
+}
+
+TEST_F(ResolutionCacheUnitTest, FailedRequestAnswersAsynchronously) {
+  std::string result = "unset";
+  cache_.Resolve("brave.eth",
+                 base::BindOnce([](ResolutionCache::ResolveCallback callback) {
+                   return false;
+                 }),
+                 CountResponse(&result));
+  EXPECT_EQ(0, response_count_);
+
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(1, response_count_);
+  EXPECT_EQ("", result);
+}
+
+}  // namespace decentralized_dns
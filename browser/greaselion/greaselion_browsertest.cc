@@ -7,8 +7,11 @@
 #include "base/path_service.h"
 #include "base/run_loop.h"
 #include "base/scoped_observation.h"
+#include "base/strings/stringprintf.h"
 #include "base/task/post_task.h"
+#include "base/test/scoped_feature_list.h"
 #include "base/test/thread_test_helper.h"
+#include "base/values.h"
 #include "brave/browser/brave_browser_process.h"
 #include "brave/browser/brave_rewards/rewards_service_factory.h"
 #include "brave/browser/extensions/brave_base_local_data_files_browsertest.h"
@@ -18,6 +21,7 @@
 #include "brave/components/brave_rewards/browser/test/common/rewards_browsertest_network_util.h"
 #include "brave/components/brave_rewards/browser/test/common/rewards_browsertest_response.h"
 #include "brave/components/brave_rewards/browser/test/common/rewards_browsertest_util.h"
+#include "brave/components/greaselion/browser/features.h"
 #include "brave/components/greaselion/browser/greaselion_download_service.h"
 #include "brave/components/greaselion/browser/greaselion_service.h"
 #include "chrome/browser/extensions/extension_browsertest.h"
@@ -140,6 +144,31 @@ class GreaselionServiceTest : public BaseLocalDataFilesBrowserTest {
     g_brave_browser_process->greaselion_download_service()->rules()->clear();
   }
 
+  // Replaces the downloaded rules with |count| generated ones. Even rules
+  // match a single host, odd ones its subdomains, and every third rule has
+  // an ads precondition.
+  void SetSyntheticRules(size_t count) {
+    GreaselionDownloadService* download_service =
+        g_brave_browser_process->greaselion_download_service();
+    download_service->rules()->clear();
+    for (size_t i = 0; i < count; ++i) {
+      base::DictionaryValue preconditions;
+      if (i % 3 == 0)
+        preconditions.SetBoolKey("ads-enabled", true);
+      base::ListValue urls;
+      urls.Append(i % 2
+                      ? base::StringPrintf("https://*.site%zu.example/*", i)
+                      : base::StringPrintf("https://site%zu.example/*", i));
+      base::ListValue scripts;
+      auto rule = std::make_unique<greaselion::GreaselionRule>(
+          base::StringPrintf("synthetic-%zu", i));
+      rule->Parse(&preconditions, &urls, &scripts, "", "", base::FilePath(),
+                  base::FilePath());
+      download_service->rules()->push_back(std::move(rule));
+    }
+    download_service->BuildRuleIndex();
+  }
+
   void StartRewards() {
     // HTTP resolver
     https_server_.SetSSLConfig(net::EmbeddedTestServer::CERT_OK);
@@ -183,6 +212,17 @@ class GreaselionServiceTest : public BaseLocalDataFilesBrowserTest {
   brave_rewards::RewardsServiceImpl* rewards_service_;
 };
 
+class GreaselionServiceLazyInstallTest : public GreaselionServiceTest {
+ public:
+  GreaselionServiceLazyInstallTest() {
+    feature_list_.InitAndEnableFeature(
+        greaselion::features::kGreaselionLazyInstall);
+  }
+
+ private:
+  base::test::ScopedFeatureList feature_list_;
+};
+
 #if !defined(OS_MAC)
 class GreaselionServiceLocaleTest : public GreaselionServiceTest {
  public:
@@ -231,6 +271,36 @@ IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, ClearCache) {
   EXPECT_EQ(size, GetRulesSize());
 }
 
+IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, RuleIndexWithManyRules) {
+  SetSyntheticRules(1000);
+  GreaselionDownloadService* download_service =
+      g_brave_browser_process->greaselion_download_service();
+
+  std::vector<const greaselion::GreaselionRule*> rules =
+      download_service->GetRulesForURL(GURL("https://site10.example/"));
+  ASSERT_EQ(rules.size(), 1u);
+  EXPECT_EQ(rules[0]->name(), "synthetic-10");
+  rules = download_service->GetRulesForURL(GURL("https://a.b.site11.example/"));
+  ASSERT_EQ(rules.size(), 1u);
+  EXPECT_EQ(rules[0]->name(), "synthetic-11");
+  // Rule 10 does not match subdomains.
+  EXPECT_TRUE(
+      download_service->GetRulesForURL(GURL("https://a.site10.example/"))
+          .empty());
+  EXPECT_TRUE(
+      download_service->GetRulesForURL(GURL("http://site10.example/")).empty());
+  EXPECT_TRUE(
+      download_service->GetRulesForURL(GURL("https://site1000.example/"))
+          .empty());
+
+  EXPECT_EQ(download_service->GetRulesDependingOn(greaselion::ADS).size(),
+            334u);
+  EXPECT_TRUE(
+      download_service->GetRulesDependingOn(greaselion::REWARDS).empty());
+  EXPECT_TRUE(download_service->rules()->at(0)->DependsOn(greaselion::ADS));
+  EXPECT_FALSE(download_service->rules()->at(1)->DependsOn(greaselion::ADS));
+}
+
 IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, ScriptInjection) {
   ASSERT_TRUE(InstallMockExtension());
   GURL url = embedded_test_server()->GetURL("www.a.com", "/simple.html");
@@ -248,6 +318,52 @@ IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, ScriptInjection) {
   EXPECT_EQ(title, "Altered");
 }
 
+IN_PROC_BROWSER_TEST_F(GreaselionServiceLazyInstallTest,
+                       InstallsExtensionOnNavigation) {
+  ASSERT_TRUE(InstallMockExtension());
+  GreaselionService* greaselion_service =
+      GreaselionServiceFactory::GetForBrowserContext(profile());
+  EXPECT_TRUE(greaselion_service->GetExtensionIdsForTesting().empty());
+
+  GURL url = embedded_test_server()->GetURL("www.a.com", "/simple.html");
+  ui_test_utils::NavigateToURL(browser(), url);
+  GreaselionServiceWaiter(greaselion_service).Wait();
+  EXPECT_FALSE(greaselion_service->GetExtensionIdsForTesting().empty());
+
+  // Scripts are injected from the next navigation on.
+  ui_test_utils::NavigateToURL(browser(), url);
+  content::WebContents* contents =
+      browser()->tab_strip_model()->GetActiveWebContents();
+  ASSERT_TRUE(content::WaitForLoadStop(contents));
+  std::string title;
+  ASSERT_TRUE(
+      ExecuteScriptAndExtractString(contents,
+                                    "window.domAutomationController.send("
+                                    "document.title)",
+                                    &title));
+  EXPECT_EQ(title, "Altered");
+}
+
+IN_PROC_BROWSER_TEST_F(GreaselionServiceLazyInstallTest,
+                       PRE_InstallsRequestedRulesOnStartup) {
+  ASSERT_TRUE(InstallMockExtension());
+  GreaselionService* greaselion_service =
+      GreaselionServiceFactory::GetForBrowserContext(profile());
+  GURL url = embedded_test_server()->GetURL("www.a.com", "/simple.html");
+  ui_test_utils::NavigateToURL(browser(), url);
+  GreaselionServiceWaiter(greaselion_service).Wait();
+  EXPECT_FALSE(greaselion_service->GetExtensionIdsForTesting().empty());
+}
+
+IN_PROC_BROWSER_TEST_F(GreaselionServiceLazyInstallTest,
+                       InstallsRequestedRulesOnStartup) {
+  // Rules requested before the restart are installed without navigating.
+  ASSERT_TRUE(InstallMockExtension());
+  GreaselionService* greaselion_service =
+      GreaselionServiceFactory::GetForBrowserContext(profile());
+  EXPECT_FALSE(greaselion_service->GetExtensionIdsForTesting().empty());
+}
+
 IN_PROC_BROWSER_TEST_F(GreaselionServiceTest, ScriptInjectionDocumentStart) {
   ASSERT_TRUE(InstallMockExtension());
   GURL url = embedded_test_server()->GetURL("runat1.b.com", "/intercept.html");
@@ -15,6 +15,7 @@
 #include "brave/components/greaselion/browser/greaselion_download_service.h"
 #include "brave/components/greaselion/browser/greaselion_service.h"
 #include "content/public/browser/browser_context.h"
+#include "content/public/browser/navigation_handle.h"
 #include "content/public/browser/web_contents.h"
 #include "content/public/browser/web_contents_user_data.h"
 
@@ -38,6 +39,29 @@ void GreaselionTabHelper::OnRulesReady(
     greaselion_service->UpdateInstalledExtensions();
 }
 
+void GreaselionTabHelper::DidStartNavigation(
+    content::NavigationHandle* navigation_handle) {
+  InstallExtensionsForNavigation(navigation_handle);
+}
+
+void GreaselionTabHelper::DidRedirectNavigation(
+    content::NavigationHandle* navigation_handle) {
+  // The rules for the final URL may differ from those for the start URL.
+  InstallExtensionsForNavigation(navigation_handle);
+}
+
+void GreaselionTabHelper::InstallExtensionsForNavigation(
+    content::NavigationHandle* navigation_handle) {
+  // Greaselion content scripts only run in the main frame.
+  if (!navigation_handle->IsInMainFrame() ||
+      navigation_handle->IsSameDocument())
+    return;
+  auto* greaselion_service = GreaselionServiceFactory::GetForBrowserContext(
+      web_contents()->GetBrowserContext());
+  if (greaselion_service)
+    greaselion_service->InstallExtensionsForURL(navigation_handle->GetURL());
+}
+
 WEB_CONTENTS_USER_DATA_KEY_IMPL(GreaselionTabHelper)
 
 }  // namespace greaselion
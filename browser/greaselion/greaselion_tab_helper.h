@@ -11,6 +11,7 @@
 #include "content/public/browser/web_contents_user_data.h"
 
 namespace content {
+class NavigationHandle;
 class WebContents;
 }
 
@@ -30,6 +31,15 @@ class GreaselionTabHelper
   // GreaselionDownloadService::Observer implementation
   void OnRulesReady(GreaselionDownloadService* download_service) override;
 
+  // content::WebContentsObserver implementation
+  void DidStartNavigation(
+      content::NavigationHandle* navigation_handle) override;
+  void DidRedirectNavigation(
+      content::NavigationHandle* navigation_handle) override;
+
+  void InstallExtensionsForNavigation(
+      content::NavigationHandle* navigation_handle);
+
   GreaselionDownloadService* download_service_;  // NOT OWNED
 
   WEB_CONTENTS_USER_DATA_KEY_DECL();
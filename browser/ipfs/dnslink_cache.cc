@@ -0,0 +1,104 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/ipfs/dnslink_cache.h"
+
+#include <memory>
+#include <utility>
+
+#include "content/public/browser/browser_context.h"
+#include "content/public/browser/browser_thread.h"
+
+namespace {
+
+const char kDNSLinkCacheKey[] = "brave_dnslink_cache";
+const size_t kMaxEntries = 256;
+
+}  // namespace
+
+namespace ipfs {
+
+constexpr base::TimeDelta DNSLinkCache::kResolvedTTL;
+constexpr base::TimeDelta DNSLinkCache::kFailedTTL;
+
+DNSLinkCache::DNSLinkCache() : entries_(kMaxEntries) {}
+
+DNSLinkCache::~DNSLinkCache() = default;
+
+// static
+DNSLinkCache* DNSLinkCache::FromBrowserContext(
+    content::BrowserContext* browser_context) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  DCHECK(browser_context);
+
+  auto* cache =
+      static_cast<DNSLinkCache*>(browser_context->GetUserData(kDNSLinkCacheKey));
+  if (!cache) {
+    auto new_cache = std::make_unique<DNSLinkCache>();
+    cache = new_cache.get();
+    browser_context->SetUserData(kDNSLinkCacheKey, std::move(new_cache));
+  }
+
+  return cache;
+}
+
+bool DNSLinkCache::Lookup(const std::string& host,
+                          bool* resolved,
+                          std::string* dnslink) {
+  DCHECK(resolved);
+  DCHECK(dnslink);
+
+  auto it = entries_.Get(host);
+  if (it != entries_.end() && it->second.expiration <= base::TimeTicks::Now()) {
+    entries_.Erase(it);
+    it = entries_.end();
+  }
+
+  if (it == entries_.end()) {
+    misses_++;
+    return false;
+  }
+
+  hits_++;
+  *resolved = it->second.resolved;
+  *dnslink = it->second.dnslink;
+  return true;
+}
+
+bool DNSLinkCache::AddPendingLookup(const std::string& host,
+                                    LookupCallback callback) {
+  auto& callbacks = pending_lookups_[host];
+  callbacks.push_back(std::move(callback));
+  return callbacks.size() == 1;
+}
+
+void DNSLinkCache::OnLookupComplete(const std::string& host,
+                                    bool resolved,
+                                    const std::string& dnslink) {
+  entries_.Put(host, {resolved, dnslink,
+                      base::TimeTicks::Now() +
+                          (resolved ? kResolvedTTL : kFailedTTL)});
+  RunPendingCallbacks(
+      host, resolved ? LookupStatus::kResolved : LookupStatus::kFailed,
+      dnslink);
+}
+
+void DNSLinkCache::CancelLookup(const std::string& host) {
+  RunPendingCallbacks(host, LookupStatus::kCancelled, std::string());
+}
+
+void DNSLinkCache::RunPendingCallbacks(const std::string& host,
+                                       LookupStatus status,
+                                       const std::string& dnslink) {
+  auto it = pending_lookups_.find(host);
+  if (it == pending_lookups_.end())
+    return;
+  std::vector<LookupCallback> callbacks = std::move(it->second);
+  pending_lookups_.erase(it);
+  for (auto& callback : callbacks)
+    std::move(callback).Run(status, dnslink);
+}
+
+}  // namespace ipfs
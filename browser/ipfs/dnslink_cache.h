@@ -0,0 +1,94 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_BROWSER_IPFS_DNSLINK_CACHE_H_
+#define BRAVE_BROWSER_IPFS_DNSLINK_CACHE_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "base/callback.h"
+#include "base/containers/mru_cache.h"
+#include "base/supports_user_data.h"
+#include "base/time/time.h"
+
+namespace content {
+class BrowserContext;
+}  // namespace content
+
+namespace ipfs {
+
+// Per-profile cache of DNSLink TXT lookups keyed by the queried host, shared
+// by the IPFSHostResolver of every tab so that navigations to the same site
+// issue one query per TTL. Hosts that resolved are kept for kResolvedTTL,
+// including those without a DNSLink record; failed lookups are kept for the
+// shorter kFailedTTL. Must only be used on the UI thread.
+class DNSLinkCache : public base::SupportsUserData::Data {
+ public:
+  enum class LookupStatus {
+    kResolved,
+    kFailed,
+    // The resolver running the lookup went away before it was answered.
+    // Nothing was cached, so a waiter should issue the lookup itself.
+    kCancelled,
+  };
+  using LookupCallback =
+      base::OnceCallback<void(LookupStatus status, const std::string& dnslink)>;
+
+  static constexpr base::TimeDelta kResolvedTTL =
+      base::TimeDelta::FromMinutes(5);
+  static constexpr base::TimeDelta kFailedTTL =
+      base::TimeDelta::FromSeconds(30);
+
+  DNSLinkCache();
+  ~DNSLinkCache() override;
+
+  DNSLinkCache(const DNSLinkCache&) = delete;
+  DNSLinkCache& operator=(const DNSLinkCache&) = delete;
+
+  static DNSLinkCache* FromBrowserContext(
+      content::BrowserContext* browser_context);
+
+  // Returns true and fills |resolved| and |dnslink| if an unexpired entry for
+  // |host| exists.
+  bool Lookup(const std::string& host, bool* resolved, std::string* dnslink);
+
+  // Queues |callback| until the lookup of |host| completes. Returns true if
+  // no lookup was in flight, in which case the caller must issue it and
+  // report back with OnLookupComplete() or CancelLookup().
+  bool AddPendingLookup(const std::string& host, LookupCallback callback);
+
+  // Caches the result for |host| and answers every queued callback.
+  void OnLookupComplete(const std::string& host,
+                        bool resolved,
+                        const std::string& dnslink);
+
+  // Answers every queued callback for |host| with kCancelled without caching.
+  void CancelLookup(const std::string& host);
+
+  size_t hits() const { return hits_; }
+  size_t misses() const { return misses_; }
+
+ private:
+  struct Entry {
+    bool resolved;
+    std::string dnslink;
+    base::TimeTicks expiration;
+  };
+
+  void RunPendingCallbacks(const std::string& host,
+                           LookupStatus status,
+                           const std::string& dnslink);
+
+  base::MRUCache<std::string, Entry> entries_;
+  std::map<std::string, std::vector<LookupCallback>> pending_lookups_;
+  size_t hits_ = 0;
+  size_t misses_ = 0;
+};
+
+}  // namespace ipfs
+
+#endif  // BRAVE_BROWSER_IPFS_DNSLINK_CACHE_H_
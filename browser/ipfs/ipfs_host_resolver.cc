@@ -6,8 +6,10 @@
 #include <utility>
 #include <vector>
 
+#include "base/bind.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_split.h"
+#include "brave/browser/ipfs/dnslink_cache.h"
 #include "brave/browser/ipfs/ipfs_host_resolver.h"
 #include "chrome/browser/net/secure_dns_config.h"
 #include "chrome/browser/net/system_network_context_manager.h"
@@ -43,11 +45,15 @@ namespace ipfs {
 
 IPFSHostResolver::IPFSHostResolver(
     network::mojom::NetworkContext* network_context,
-    const std::string& prefix)
-    : prefix_(prefix), network_context_(network_context) {
+    const std::string& prefix,
+    DNSLinkCache* cache)
+    : prefix_(prefix), network_context_(network_context), cache_(cache) {
   DCHECK(network_context);
 }
-IPFSHostResolver::~IPFSHostResolver() {}
+
+IPFSHostResolver::~IPFSHostResolver() {
+  CancelOwnLookup();
+}
 
 void IPFSHostResolver::Resolve(const net::HostPortPair& host,
                                const net::NetworkIsolationKey& isolation_key,
@@ -63,17 +69,53 @@ void IPFSHostResolver::Resolve(const net::HostPortPair& host,
     return;
   }
 
-  network::mojom::ResolveHostParametersPtr parameters =
-      network::mojom::ResolveHostParameters::New();
-  parameters->dns_query_type = dns_query_type;
-
+  CancelOwnLookup();
+  // Drop the query and any cache callback still queued for the previous host,
+  // so that each resolver waits on the cache at most once.
   receiver_.reset();
+  weak_ptr_factory_.InvalidateWeakPtrs();
   resolved_callback_ = std::move(callback);
   dnslink_.erase();
   resolving_host_ = host.host();
-  net::HostPortPair local_host_port(prefix_ + resolving_host_, host.port());
+  lookup_host_port_ = net::HostPortPair(prefix_ + resolving_host_, host.port());
+  isolation_key_ = isolation_key;
+  dns_query_type_ = dns_query_type;
+  StartLookup();
+}
+
+void IPFSHostResolver::StartLookup() {
+  if (cache_) {
+    bool resolved = false;
+    std::string dnslink;
+    if (cache_->Lookup(lookup_host_port_.host(), &resolved, &dnslink)) {
+      OnLookupResult(resolving_host_,
+                     resolved ? DNSLinkCache::LookupStatus::kResolved
+                              : DNSLinkCache::LookupStatus::kFailed,
+                     dnslink);
+      return;
+    }
+  }
+  IssueLookup();
+}
+
+void IPFSHostResolver::IssueLookup() {
+  DCHECK(!owns_cache_lookup_);
+  if (cache_) {
+    if (!cache_->AddPendingLookup(
+            lookup_host_port_.host(),
+            base::BindOnce(&IPFSHostResolver::OnLookupResult,
+                           weak_ptr_factory_.GetWeakPtr(), resolving_host_))) {
+      // Another resolver is already querying this host.
+      return;
+    }
+    owns_cache_lookup_ = true;
+  }
+
+  network::mojom::ResolveHostParametersPtr parameters =
+      network::mojom::ResolveHostParameters::New();
+  parameters->dns_query_type = dns_query_type_;
 
-  network_context_->ResolveHost(local_host_port, isolation_key,
+  network_context_->ResolveHost(lookup_host_port_, isolation_key_,
                                 std::move(parameters),
                                 receiver_.BindNewPipeAndPassRemote());
 }
@@ -86,6 +128,11 @@ void IPFSHostResolver::OnComplete(
     VLOG(1) << "DNS resolving error:" << net::ErrorToString(result)
             << " for host: " << prefix_ + resolving_host_;
   }
+  // No TXT records were delivered, so the lookup failed for the cache.
+  if (owns_cache_lookup_) {
+    owns_cache_lookup_ = false;
+    cache_->OnLookupComplete(prefix_ + resolving_host_, false, std::string());
+  }
   if (complete_callback_for_testing_)
     std::move(complete_callback_for_testing_).Run();
 }
@@ -93,10 +140,53 @@ void IPFSHostResolver::OnComplete(
 void IPFSHostResolver::OnTextResults(const std::vector<std::string>& results) {
   VLOG(2) << results.size()
           << " TXT records resolved for host: " << prefix_ + resolving_host_;
-  dnslink_ = GetDNSRecordValue(results, kDnsLinkHeader);
+  std::string dnslink = GetDNSRecordValue(results, kDnsLinkHeader);
+
+  if (owns_cache_lookup_) {
+    owns_cache_lookup_ = false;
+    // Answers this resolver too through OnLookupResult.
+    cache_->OnLookupComplete(prefix_ + resolving_host_, true, dnslink);
+    return;
+  }
+
+  OnLookupResult(resolving_host_, DNSLinkCache::LookupStatus::kResolved,
+                 dnslink);
+}
+
+void IPFSHostResolver::OnLookupResult(const std::string& host,
+                                      DNSLinkCache::LookupStatus status,
+                                      const std::string& dnslink) {
+  if (host != resolving_host_)
+    return;
+  switch (status) {
+    case DNSLinkCache::LookupStatus::kCancelled:
+      // The resolver running the shared query went away. The first waiter
+      // to get here takes the query over, the others wait for it again. The
+      // cache was already missed for this host, so don't look it up again.
+      if (!owns_cache_lookup_)
+        IssueLookup();
+      return;
+    case DNSLinkCache::LookupStatus::kFailed:
+      // Failed lookups leave the callback pending, as an unanswered query
+      // would.
+      return;
+    case DNSLinkCache::LookupStatus::kResolved:
+      break;
+  }
+  dnslink_ = dnslink;
 
   if (resolved_callback_)
     std::move(resolved_callback_).Run(resolving_host_, dnslink_);
 }
 
+void IPFSHostResolver::CancelOwnLookup() {
+  if (!owns_cache_lookup_)
+    return;
+  owns_cache_lookup_ = false;
+  // Forget the host first, so that our own queued callback is ignored.
+  const std::string lookup_host = lookup_host_port_.host();
+  resolving_host_.clear();
+  cache_->CancelLookup(lookup_host);
+}
+
 }  // namespace ipfs
@@ -11,6 +11,8 @@
 #include <vector>
 
 #include "base/callback_forward.h"
+#include "base/memory/weak_ptr.h"
+#include "brave/browser/ipfs/dnslink_cache.h"
 #include "net/base/host_port_pair.h"
 #include "net/base/network_isolation_key.h"
 #include "net/dns/public/dns_query_type.h"
@@ -21,11 +23,13 @@
 namespace ipfs {
 
 // Resolves DNS TXT record for hosts. If prefix passed then
-// automatically adds it to the host.
+// automatically adds it to the host. If a cache is passed then answers are
+// shared with every other resolver using it.
 class IPFSHostResolver : public network::ResolveHostClientBase {
  public:
   explicit IPFSHostResolver(network::mojom::NetworkContext* network_context,
-                            const std::string& prefix = std::string());
+                            const std::string& prefix = std::string(),
+                            DNSLinkCache* cache = nullptr);
   ~IPFSHostResolver() override;
 
   using HostTextResultsCallback =
@@ -52,15 +56,30 @@ class IPFSHostResolver : public network::ResolveHostClientBase {
       const absl::optional<net::AddressList>& resolved_addresses) override;
   void OnTextResults(const std::vector<std::string>& text_results) override;
 
+  void StartLookup();
+  void IssueLookup();
+  void OnLookupResult(const std::string& host,
+                      DNSLinkCache::LookupStatus status,
+                      const std::string& dnslink);
+  void CancelOwnLookup();
+
   std::string resolving_host_;
   std::string prefix_;
   std::string dnslink_;
+  // Parameters of the query for |resolving_host_|, kept to re-issue it.
+  net::HostPortPair lookup_host_port_;
+  net::NetworkIsolationKey isolation_key_;
+  net::DnsQueryType dns_query_type_ = net::DnsQueryType::UNSPECIFIED;
 
   network::mojom::NetworkContext* network_context_ = nullptr;
+  DNSLinkCache* cache_ = nullptr;
+  // True while this resolver runs the cache's lookup for |resolving_host_|.
+  bool owns_cache_lookup_ = false;
   HostTextResultsCallback resolved_callback_;
   base::OnceClosure complete_callback_for_testing_;
 
   mojo::Receiver<network::mojom::ResolveHostClient> receiver_{this};
+  base::WeakPtrFactory<IPFSHostResolver> weak_ptr_factory_{this};
 };
 
 }  // namespace ipfs
@@ -11,6 +11,7 @@
 #include "base/run_loop.h"
 #include "base/test/bind.h"
 #include "base/test/task_environment.h"
+#include "brave/browser/ipfs/dnslink_cache.h"
 
 #include "chrome/browser/net/secure_dns_config.h"
 #include "chrome/browser/net/stub_resolver_config_reader.h"
@@ -148,7 +149,15 @@ class IPFSHostResolverTest : public testing::Test {
   }
   int resolved_callback_called() const { return resolved_callback_called_; }
 
-  content::BrowserTaskEnvironment task_environment_;
+  ipfs::IPFSHostResolver::HostTextResultsCallback ExpectHost(
+      const std::string& expected_host) {
+    return base::BindOnce(&IPFSHostResolverTest::HostResolvedCallback,
+                          weak_ptr_factory_.GetWeakPtr(), base::OnceClosure(),
+                          expected_host);
+  }
+
+  content::BrowserTaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
   int resolved_callback_called_ = 0;
   std::unique_ptr<FakeNetworkContext> network_context_;
   std::unique_ptr<ScopedTestingLocalState> local_state_;
@@ -248,3 +257,181 @@ TEST_F(IPFSHostResolverTest, ResolutionFailed) {
   EXPECT_EQ(fake_host_resolver_raw->resolve_host_called(), 1);
   EXPECT_EQ(resolved_callback_called(), 0);
 }
+
+TEST_F(IPFSHostResolverTest, CacheSharesLookups) {
+  std::string prefix = "__dnslink.";
+  std::string host = "example.com";
+
+  std::unique_ptr<FakeHostResolver> fake_host_resolver(
+      new FakeHostResolver(prefix + host));
+  fake_host_resolver->RespondTextResults({"dnslink=abc"});
+  auto* network_context = GetNetworkContext();
+  auto* fake_host_resolver_raw = fake_host_resolver.get();
+  network_context->SetHostResolver(std::move(fake_host_resolver));
+  ipfs::DNSLinkCache cache;
+  ipfs::IPFSHostResolver first_resolver(network_context, prefix, &cache);
+  ipfs::IPFSHostResolver second_resolver(network_context, prefix, &cache);
+
+  // Concurrent lookups of the same host share one query.
+  SetResolvedCallbackCalled(0);
+  first_resolver.Resolve(net::HostPortPair(host, 11),
+                         net::NetworkIsolationKey(), net::DnsQueryType::TXT,
+                         ExpectHost(host));
+  second_resolver.Resolve(net::HostPortPair(host, 11),
+                          net::NetworkIsolationKey(), net::DnsQueryType::TXT,
+                          ExpectHost(host));
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(fake_host_resolver_raw->resolve_host_called(), 1);
+  EXPECT_EQ(resolved_callback_called(), 2);
+  EXPECT_EQ(first_resolver.dnslink(), "abc");
+  EXPECT_EQ(second_resolver.dnslink(), "abc");
+  EXPECT_EQ(cache.hits(), 0u);
+  EXPECT_EQ(cache.misses(), 2u);
+
+  // Later lookups are answered from the cache until the entry expires.
+  ipfs::IPFSHostResolver third_resolver(network_context, prefix, &cache);
+  third_resolver.Resolve(net::HostPortPair(host, 11),
+                         net::NetworkIsolationKey(), net::DnsQueryType::TXT,
+                         ExpectHost(host));
+  EXPECT_EQ(fake_host_resolver_raw->resolve_host_called(), 1);
+  EXPECT_EQ(resolved_callback_called(), 3);
+  EXPECT_EQ(third_resolver.dnslink(), "abc");
+  EXPECT_EQ(cache.hits(), 1u);
+
+  task_environment_.FastForwardBy(ipfs::DNSLinkCache::kResolvedTTL);
+  ipfs::IPFSHostResolver fourth_resolver(network_context, prefix, &cache);
+  fourth_resolver.Resolve(net::HostPortPair(host, 11),
+                          net::NetworkIsolationKey(), net::DnsQueryType::TXT,
+                          ExpectHost(host));
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(fake_host_resolver_raw->resolve_host_called(), 2);
+  EXPECT_EQ(resolved_callback_called(), 4);
+  EXPECT_EQ(cache.misses(), 3u);
+}
+
+TEST_F(IPFSHostResolverTest, CacheKeepsFailedLookups) {
+  std::string host = "example.com";
+  std::unique_ptr<FakeHostResolverFail> fake_host_resolver(
+      new FakeHostResolverFail(host));
+  auto* network_context = GetNetworkContext();
+  auto* fake_host_resolver_raw = fake_host_resolver.get();
+  network_context->SetHostResolver(std::move(fake_host_resolver));
+  ipfs::DNSLinkCache cache;
+  ipfs::IPFSHostResolver first_resolver(network_context, std::string(),
+                                        &cache);
+
+  SetResolvedCallbackCalled(0);
+  first_resolver.Resolve(net::HostPortPair(host, 11),
+                         net::NetworkIsolationKey(), net::DnsQueryType::TXT,
+                         ExpectHost(host));
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(fake_host_resolver_raw->resolve_host_called(), 1);
+  EXPECT_EQ(resolved_callback_called(), 0);
+
+  ipfs::IPFSHostResolver second_resolver(network_context, std::string(),
+                                         &cache);
+  second_resolver.Resolve(net::HostPortPair(host, 11),
+                          net::NetworkIsolationKey(), net::DnsQueryType::TXT,
+                          ExpectHost(host));
+  EXPECT_EQ(fake_host_resolver_raw->resolve_host_called(), 1);
+  EXPECT_EQ(resolved_callback_called(), 0);
+  EXPECT_EQ(cache.hits(), 1u);
+
+  task_environment_.FastForwardBy(ipfs::DNSLinkCache::kFailedTTL);
+  ipfs::IPFSHostResolver third_resolver(network_context, std::string(),
+                                        &cache);
+  third_resolver.Resolve(net::HostPortPair(host, 11),
+                         net::NetworkIsolationKey(), net::DnsQueryType::TXT,
+                         ExpectHost(host));
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(fake_host_resolver_raw->resolve_host_called(), 2);
+}
+
+TEST_F(IPFSHostResolverTest, CacheWaiterTakesOverCancelledLookup) {
+  std::string prefix = "__dnslink.";
+  std::string host = "example.com";
+
+  std::unique_ptr<FakeHostResolver> fake_host_resolver(
+      new FakeHostResolver(prefix + host));
+  fake_host_resolver->RespondTextResults({"dnslink=abc"});
+  auto* network_context = GetNetworkContext();
+  auto* fake_host_resolver_raw = fake_host_resolver.get();
+  network_context->SetHostResolver(std::move(fake_host_resolver));
+  ipfs::DNSLinkCache cache;
+  auto first_resolver =
+      std::make_unique<ipfs::IPFSHostResolver>(network_context, prefix, &cache);
+  ipfs::IPFSHostResolver second_resolver(network_context, prefix, &cache);
+
+  SetResolvedCallbackCalled(0);
+  first_resolver->Resolve(net::HostPortPair(host, 11),
+                          net::NetworkIsolationKey(), net::DnsQueryType::TXT,
+                          ExpectHost(host));
+  second_resolver.Resolve(net::HostPortPair(host, 11),
+                          net::NetworkIsolationKey(), net::DnsQueryType::TXT,
+                          ExpectHost(host));
+  EXPECT_EQ(fake_host_resolver_raw->resolve_host_called(), 1);
+
+  // The resolver running the query goes away before it is answered, so the
+  // waiting one issues the query itself.
+  first_resolver.reset();
+  EXPECT_EQ(fake_host_resolver_raw->resolve_host_called(), 2);
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(resolved_callback_called(), 1);
+  EXPECT_EQ(second_resolver.host(), host);
+  EXPECT_EQ(second_resolver.dnslink(), "abc");
+}
+
+TEST_F(IPFSHostResolverTest, CacheWaiterSwitchingBackTakesOverOnce) {
+  std::string prefix = "__dnslink.";
+  std::string host = "example.com";
+  std::string other_host = "other.com";
+
+  std::unique_ptr<FakeHostResolver> fake_host_resolver(
+      new FakeHostResolver(prefix + host));
+  fake_host_resolver->RespondTextResults({"dnslink=abc"});
+  auto* network_context = GetNetworkContext();
+  auto* fake_host_resolver_raw = fake_host_resolver.get();
+  network_context->SetHostResolver(std::move(fake_host_resolver));
+  ipfs::DNSLinkCache cache;
+  auto first_resolver =
+      std::make_unique<ipfs::IPFSHostResolver>(network_context, prefix, &cache);
+  ipfs::IPFSHostResolver second_resolver(network_context, prefix, &cache);
+
+  SetResolvedCallbackCalled(0);
+  first_resolver->Resolve(net::HostPortPair(host, 11),
+                          net::NetworkIsolationKey(), net::DnsQueryType::TXT,
+                          ExpectHost(host));
+  second_resolver.Resolve(net::HostPortPair(host, 11),
+                          net::NetworkIsolationKey(), net::DnsQueryType::TXT,
+                          ExpectHost(host));
+
+  // The waiting resolver switches to another host and back while the first
+  // query is still in flight.
+  fake_host_resolver_raw->SetExpectedHost(prefix + other_host);
+  second_resolver.Resolve(net::HostPortPair(other_host, 11),
+                          net::NetworkIsolationKey(), net::DnsQueryType::TXT,
+                          ExpectHost(other_host));
+  second_resolver.Resolve(net::HostPortPair(host, 11),
+                          net::NetworkIsolationKey(), net::DnsQueryType::TXT,
+                          ExpectHost(host));
+  EXPECT_EQ(fake_host_resolver_raw->resolve_host_called(), 2);
+  EXPECT_EQ(cache.misses(), 4u);
+
+  // Taking over the cancelled query issues it exactly once and keeps it.
+  fake_host_resolver_raw->SetExpectedHost(prefix + host);
+  first_resolver.reset();
+  EXPECT_EQ(fake_host_resolver_raw->resolve_host_called(), 3);
+  EXPECT_EQ(cache.misses(), 4u);
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(resolved_callback_called(), 1);
+  EXPECT_EQ(second_resolver.host(), host);
+  EXPECT_EQ(second_resolver.dnslink(), "abc");
+
+  // The answer was cached for everyone else.
+  ipfs::IPFSHostResolver third_resolver(network_context, prefix, &cache);
+  third_resolver.Resolve(net::HostPortPair(host, 11),
+                         net::NetworkIsolationKey(), net::DnsQueryType::TXT,
+                         ExpectHost(host));
+  EXPECT_EQ(fake_host_resolver_raw->resolve_host_called(), 3);
+  EXPECT_EQ(resolved_callback_called(), 2);
+}
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "base/strings/string_split.h"
+#include "brave/browser/ipfs/dnslink_cache.h"
 #include "brave/browser/ipfs/ipfs_host_resolver.h"
 #include "brave/browser/ipfs/ipfs_service_factory.h"
 #include "brave/components/ipfs/ipfs_constants.h"
@@ -104,8 +105,9 @@ IPFSTabHelper::IPFSTabHelper(content::WebContents* web_contents)
   auto* storage_partition =
       web_contents->GetBrowserContext()->GetDefaultStoragePartition();
 
-  resolver_.reset(new IPFSHostResolver(storage_partition->GetNetworkContext(),
-                                       kDnsDomainPrefix));
+  resolver_.reset(new IPFSHostResolver(
+      storage_partition->GetNetworkContext(), kDnsDomainPrefix,
+      DNSLinkCache::FromBrowserContext(web_contents->GetBrowserContext())));
   pref_change_registrar_.Init(pref_service_);
   pref_change_registrar_.Add(
       kIPFSResolveMethod,
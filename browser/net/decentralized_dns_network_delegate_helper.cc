@@ -5,15 +5,19 @@
 
 #include "brave/browser/net/decentralized_dns_network_delegate_helper.h"
 
+#include <utility>
 #include <vector>
 
 #include "net/base/net_errors.h"
 
 #include "brave/browser/brave_wallet/brave_wallet_service_factory.h"
+#include "brave/browser/decentralized_dns/decentralized_dns_service_factory.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_service.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
 #include "brave/components/brave_wallet/browser/eth_json_rpc_controller.h"
 #include "brave/components/decentralized_dns/constants.h"
+#include "brave/components/decentralized_dns/decentralized_dns_service.h"
+#include "brave/components/decentralized_dns/resolution_cache.h"
 #include "brave/components/decentralized_dns/utils.h"
 #include "brave/components/ipfs/ipfs_utils.h"
 #include "chrome/browser/browser_process.h"
@@ -23,10 +27,53 @@ namespace decentralized_dns {
 
 namespace {
 
+const char kENSCacheKeyPrefix[] = "ens:";
+const char kUnstoppableDomainsCacheKeyPrefix[] = "ud:";
+
 std::string GetValue(const std::vector<std::string>& arr, RecordKeys key) {
   return arr[static_cast<size_t>(key)];
 }
 
+// Results depend on the network the wallet is talking to, so it is part of
+// the key along with the host.
+std::string GetCacheKey(const char* prefix,
+                        brave_wallet::BraveWalletService* service,
+                        const std::string& host) {
+  return prefix + service->rpc_controller()->GetNetworkURL().spec() + " " +
+         host;
+}
+
+// Applies a cached result synchronously when there is one, otherwise issues
+// |start_request| through the profile's resolution cache so concurrent
+// requests for the same name share one RPC.
+int ResolveWithCache(
+    content::BrowserContext* context,
+    const std::string& key,
+    ResolutionCache::StartRequestCallback start_request,
+    ResolutionCache::ResolveCallback on_resolved,
+    ResolutionCache::ResolveCallback on_cached) {
+  ResolutionCache* cache = nullptr;
+  if (auto* dns_service =
+          DecentralizedDnsServiceFactory::GetForContext(context)) {
+    cache = dns_service->resolution_cache();
+  }
+
+  if (!cache) {
+    std::move(start_request).Run(std::move(on_resolved));
+    return net::ERR_IO_PENDING;
+  }
+
+  bool success = false;
+  std::string result;
+  if (cache->Lookup(key, &success, &result)) {
+    std::move(on_cached).Run(success, result);
+    return net::OK;
+  }
+
+  cache->Resolve(key, std::move(start_request), std::move(on_resolved));
+  return net::ERR_IO_PENDING;
+}
+
 }  // namespace
 
 int OnBeforeURLRequest_DecentralizedDnsPreRedirectWork(
@@ -46,14 +93,21 @@ int OnBeforeURLRequest_DecentralizedDnsPreRedirectWork(
       return net::OK;
     }
 
-    service->rpc_controller()->UnstoppableDomainsProxyReaderGetMany(
-        kProxyReaderContractAddress, ctx->request_url.host(),
-        std::vector<std::string>(std::begin(kRecordKeys),
-                                 std::end(kRecordKeys)),
+    return ResolveWithCache(
+        ctx->browser_context,
+        GetCacheKey(kUnstoppableDomainsCacheKeyPrefix, service,
+                    ctx->request_url.host()),
+        base::BindOnce(
+            &brave_wallet::EthJsonRpcController::
+                UnstoppableDomainsProxyReaderGetMany,
+            base::Unretained(service->rpc_controller()),
+            kProxyReaderContractAddress, ctx->request_url.host(),
+            std::vector<std::string>(std::begin(kRecordKeys),
+                                     std::end(kRecordKeys))),
         base::BindOnce(&OnBeforeURLRequest_DecentralizedDnsRedirectWork,
-                       next_callback, ctx));
-
-    return net::ERR_IO_PENDING;
+                       next_callback, ctx),
+        base::BindOnce(&OnBeforeURLRequest_DecentralizedDnsRedirectWork,
+                       brave::ResponseCallback(), ctx));
   }
 
   if (IsENSTLD(ctx->request_url) &&
@@ -64,14 +118,19 @@ int OnBeforeURLRequest_DecentralizedDnsPreRedirectWork(
       return net::OK;
     }
 
-    service->rpc_controller()->EnsProxyReaderResolveAddress(
-        kEnsRegistryContractAddress, ctx->request_url.host(),
-        std::vector<std::string>(std::begin(kRecordKeys),
-                                 std::end(kRecordKeys)),
+    return ResolveWithCache(
+        ctx->browser_context,
+        GetCacheKey(kENSCacheKeyPrefix, service, ctx->request_url.host()),
+        base::BindOnce(
+            &brave_wallet::EthJsonRpcController::EnsProxyReaderResolveAddress,
+            base::Unretained(service->rpc_controller()),
+            kEnsRegistryContractAddress, ctx->request_url.host(),
+            std::vector<std::string>(std::begin(kRecordKeys),
+                                     std::end(kRecordKeys))),
         base::BindOnce(&OnBeforeURLRequest_EnsRedirectWork, next_callback,
-                       ctx));
-
-    return net::ERR_IO_PENDING;
+                       ctx),
+        base::BindOnce(&OnBeforeURLRequest_EnsRedirectWork,
+                       brave::ResponseCallback(), ctx));
   }
 
   return net::OK;
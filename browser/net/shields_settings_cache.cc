@@ -0,0 +1,96 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/shields_settings_cache.h"
+
+#include <memory>
+
+#include "brave/components/brave_shields/browser/brave_shields_util.h"
+#include "chrome/browser/content_settings/host_content_settings_map_factory.h"
+#include "chrome/browser/profiles/profile.h"
+#include "content/public/browser/browser_context.h"
+#include "content/public/browser/browser_thread.h"
+
+namespace brave {
+
+namespace {
+
+const char kShieldsSettingsCacheKey[] = "brave_shields_settings_cache";
+
+// Enough for the tab origins of all open tabs plus redirect sources
+constexpr size_t kMaxSnapshots = 256;
+
+ShieldsSettingsSnapshot MakeSnapshot(HostContentSettingsMap* map,
+                                     const GURL& url) {
+  ShieldsSettingsSnapshot snapshot;
+  snapshot.allow_brave_shields =
+      brave_shields::GetBraveShieldsEnabled(map, url);
+  snapshot.allow_ads = brave_shields::GetAdControlType(map, url) ==
+                       brave_shields::ControlType::ALLOW;
+  snapshot.allow_http_upgradable_resource =
+      !brave_shields::GetHTTPSEverywhereEnabled(map, url);
+  snapshot.allow_referrers = brave_shields::AllowReferrers(map, url);
+  return snapshot;
+}
+
+}  // namespace
+
+ShieldsSettingsCache::ShieldsSettingsCache(HostContentSettingsMap* map)
+    : map_(map), snapshots_(kMaxSnapshots) {
+  DCHECK(map_);
+  content_settings_observation_.Observe(map_.get());
+}
+
+ShieldsSettingsCache::~ShieldsSettingsCache() = default;
+
+// static
+ShieldsSettingsCache* ShieldsSettingsCache::FromBrowserContext(
+    content::BrowserContext* browser_context) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  DCHECK(browser_context);
+
+  auto* cache = static_cast<ShieldsSettingsCache*>(
+      browser_context->GetUserData(kShieldsSettingsCacheKey));
+  if (!cache) {
+    Profile* profile = Profile::FromBrowserContext(browser_context);
+    auto new_cache = std::make_unique<ShieldsSettingsCache>(
+        HostContentSettingsMapFactory::GetForProfile(profile));
+    cache = new_cache.get();
+    browser_context->SetUserData(kShieldsSettingsCacheKey,
+                                 std::move(new_cache));
+  }
+
+  return cache;
+}
+
+const ShieldsSettingsSnapshot& ShieldsSettingsCache::Get(const GURL& url) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+
+  auto iter = snapshots_.Get(url);
+  if (iter == snapshots_.end()) {
+    iter = snapshots_.Put(url, MakeSnapshot(map_.get(), url));
+  }
+
+  return iter->second;
+}
+
+void ShieldsSettingsCache::OnContentSettingChanged(
+    const ContentSettingsPattern& primary_pattern,
+    const ContentSettingsPattern& secondary_pattern,
+    ContentSettingsType content_type) {
+  switch (content_type) {
+    case ContentSettingsType::BRAVE_SHIELDS:
+    case ContentSettingsType::BRAVE_ADS:
+    case ContentSettingsType::BRAVE_HTTP_UPGRADABLE_RESOURCES:
+    case ContentSettingsType::BRAVE_REFERRERS:
+    case ContentSettingsType::DEFAULT:
+      snapshots_.Clear();
+      break;
+    default:
+      break;
+  }
+}
+
+}  // namespace brave
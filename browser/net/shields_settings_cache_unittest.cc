@@ -0,0 +1,70 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/shields_settings_cache.h"
+
+#include <memory>
+
+#include "brave/components/brave_shields/browser/brave_shields_util.h"
+#include "chrome/browser/content_settings/host_content_settings_map_factory.h"
+#include "chrome/test/base/testing_profile.h"
+#include "content/public/test/browser_task_environment.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace brave {
+
+class ShieldsSettingsCacheTest : public testing::Test {
+ public:
+  ShieldsSettingsCacheTest() = default;
+  ~ShieldsSettingsCacheTest() override = default;
+
+  void SetUp() override { profile_ = std::make_unique<TestingProfile>(); }
+
+  TestingProfile* profile() { return profile_.get(); }
+
+  HostContentSettingsMap* map() {
+    return HostContentSettingsMapFactory::GetForProfile(profile());
+  }
+
+ private:
+  content::BrowserTaskEnvironment task_environment_;
+  std::unique_ptr<TestingProfile> profile_;
+};
+
+TEST_F(ShieldsSettingsCacheTest, ReturnsSameCacheForProfile) {
+  EXPECT_EQ(ShieldsSettingsCache::FromBrowserContext(profile()),
+            ShieldsSettingsCache::FromBrowserContext(profile()));
+}
+
+TEST_F(ShieldsSettingsCacheTest, MatchesContentSettings) {
+  const GURL url("https://brave.com/");
+  const ShieldsSettingsSnapshot& snapshot =
+      ShieldsSettingsCache::FromBrowserContext(profile())->Get(url);
+
+  EXPECT_EQ(brave_shields::GetBraveShieldsEnabled(map(), url),
+            snapshot.allow_brave_shields);
+  EXPECT_EQ(brave_shields::GetAdControlType(map(), url) ==
+                brave_shields::ControlType::ALLOW,
+            snapshot.allow_ads);
+  EXPECT_EQ(!brave_shields::GetHTTPSEverywhereEnabled(map(), url),
+            snapshot.allow_http_upgradable_resource);
+  EXPECT_EQ(brave_shields::AllowReferrers(map(), url),
+            snapshot.allow_referrers);
+}
+
+TEST_F(ShieldsSettingsCacheTest, InvalidatedOnContentSettingChange) {
+  const GURL url("https://brave.com/");
+  auto* cache = ShieldsSettingsCache::FromBrowserContext(profile());
+  EXPECT_TRUE(cache->Get(url).allow_brave_shields);
+
+  brave_shields::SetBraveShieldsEnabled(map(), false, url);
+  EXPECT_FALSE(cache->Get(url).allow_brave_shields);
+
+  brave_shields::SetBraveShieldsEnabled(map(), true, url);
+  EXPECT_TRUE(cache->Get(url).allow_brave_shields);
+}
+
+}  // namespace brave
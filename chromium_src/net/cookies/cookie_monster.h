@@ -49,6 +49,9 @@ class NET_EXPORT CookieMonster : public ChromiumCookieMonster {
   NetLogWithSource net_log_;
   std::map<std::string, std::unique_ptr<ChromiumCookieMonster>>
       ephemeral_cookie_stores_;
+  // Returns nullptr if nothing has been stored for |top_frame_url| yet.
+  ChromiumCookieMonster* GetEphemeralCookieStoreForTopFrameURL(
+      const GURL& top_frame_url);
   ChromiumCookieMonster* GetOrCreateEphemeralCookieStoreForTopFrameURL(
       const GURL& top_frame_url);
 };
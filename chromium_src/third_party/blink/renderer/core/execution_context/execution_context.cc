@@ -31,25 +31,10 @@ inline uint64_t lfsr_next(uint64_t v) {
   return ((v >> 1) | (((v << 62) ^ (v << 61)) & (~(~zero << 63) << 62)));
 }
 
-float Identity(float value, size_t index) {
-  return value;
-}
-
-float ConstantMultiplier(double fudge_factor, float value, size_t index) {
-  return value * fudge_factor;
-}
+const double maxUInt64AsDouble = UINT64_MAX;
 
-float PseudoRandomSequence(uint64_t seed, float value, size_t index) {
-  static uint64_t v;
-  const double maxUInt64AsDouble = UINT64_MAX;
-  if (index == 0) {
-    // start of loop, reset to initial seed which was passed in and is based on
-    // the domain key
-    v = seed;
-  }
-  // get next value in PRNG sequence
-  v = lfsr_next(v);
-  // return pseudo-random float between 0 and 0.1
+// Returns a pseudo-random float between 0 and 0.1.
+inline float PseudoRandomSample(uint64_t v) {
   return (v / maxUInt64AsDouble) / 10;
 }
 
@@ -130,28 +115,100 @@ BraveSessionCache& BraveSessionCache::From(ExecutionContext& context) {
   return *cache;
 }
 
-AudioFarblingCallback BraveSessionCache::GetAudioFarblingCallback(
+AudioFarblingHelper::AudioFarblingHelper(Mode mode,
+                                         double fudge_factor,
+                                         uint64_t seed)
+    : mode_(mode), fudge_factor_(fudge_factor), seed_(seed), state_(seed) {}
+
+AudioFarblingHelper::AudioFarblingHelper(const AudioFarblingHelper& other) =
+    default;
+
+AudioFarblingHelper& AudioFarblingHelper::operator=(
+    const AudioFarblingHelper& other) = default;
+
+AudioFarblingHelper::~AudioFarblingHelper() = default;
+
+void AudioFarblingHelper::FarbleAudioChannel(float* data, size_t count) const {
+  if (!data)
+    return;
+  switch (mode_) {
+    case Mode::kNone:
+      break;
+    case Mode::kConstantMultiplier: {
+      // Keep the multiplication in double precision so the result matches
+      // FarbleAudioSample exactly; the loop has no dependencies and
+      // vectorizes.
+      const double fudge_factor = fudge_factor_;
+      for (size_t i = 0; i < count; ++i)
+        data[i] = data[i] * fudge_factor;
+      break;
+    }
+    case Mode::kPseudoRandomSequence: {
+      uint64_t v = seed_;
+      for (size_t i = 0; i < count; ++i) {
+        v = lfsr_next(v);
+        data[i] = PseudoRandomSample(v);
+      }
+      break;
+    }
+  }
+}
+
+float AudioFarblingHelper::FarbleAudioSample(float value, size_t index) {
+  switch (mode_) {
+    case Mode::kNone:
+      return value;
+    case Mode::kConstantMultiplier:
+      return value * fudge_factor_;
+    case Mode::kPseudoRandomSequence:
+      if (index == 0) {
+        // start of loop, reset to initial seed which is based on the domain
+        // key
+        state_ = seed_;
+      }
+      state_ = lfsr_next(state_);
+      return PseudoRandomSample(state_);
+  }
+  NOTREACHED();
+  return value;
+}
+
+absl::optional<AudioFarblingHelper> BraveSessionCache::GetAudioFarblingHelper(
     blink::WebContentSettingsClient* settings) {
-  if (farbling_enabled_ && settings) {
+  if (!settings)
+    return absl::nullopt;
+  if (farbling_enabled_) {
     switch (settings->GetBraveFarblingLevel()) {
       case BraveFarblingLevel::OFF: {
         break;
       }
       case BraveFarblingLevel::BALANCED: {
         const uint64_t* fudge = reinterpret_cast<const uint64_t*>(domain_key_);
-        const double maxUInt64AsDouble = UINT64_MAX;
         double fudge_factor = 0.99 + ((*fudge / maxUInt64AsDouble) / 100);
         VLOG(1) << "audio fudge factor (based on session token) = "
                 << fudge_factor;
-        return base::BindRepeating(&ConstantMultiplier, fudge_factor);
+        return AudioFarblingHelper(
+            AudioFarblingHelper::Mode::kConstantMultiplier, fudge_factor, 0);
       }
       case BraveFarblingLevel::MAXIMUM: {
         uint64_t seed = *reinterpret_cast<uint64_t*>(domain_key_);
-        return base::BindRepeating(&PseudoRandomSequence, seed);
+        return AudioFarblingHelper(
+            AudioFarblingHelper::Mode::kPseudoRandomSequence, 1.0, seed);
       }
     }
   }
-  return base::BindRepeating(&Identity);
+  return AudioFarblingHelper(AudioFarblingHelper::Mode::kNone, 1.0, 0);
+}
+
+void BraveSessionCache::FarbleAudioChannel(
+    blink::WebContentSettingsClient* settings,
+    float* data,
+    size_t count) {
+  if (count == 0)
+    return;
+  absl::optional<AudioFarblingHelper> helper = GetAudioFarblingHelper(settings);
+  if (helper)
+    helper->FarbleAudioChannel(data, count);
 }
 
 void BraveSessionCache::PerturbPixels(blink::WebContentSettingsClient* settings,
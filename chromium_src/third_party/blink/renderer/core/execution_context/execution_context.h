@@ -10,7 +10,7 @@
 
 #include <random>
 
-#include "base/callback.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace blink {
 class WebContentSettingsClient;
@@ -26,7 +26,30 @@ using blink::TraceTrait;
 
 namespace brave {
 
-typedef base::RepeatingCallback<float(float, size_t)> AudioFarblingCallback;
+// Farbles WebAudio samples for one farbling level. Each instance carries its
+// own PRNG state, so callers on different audio threads never share it.
+class CORE_EXPORT AudioFarblingHelper {
+ public:
+  enum class Mode { kNone, kConstantMultiplier, kPseudoRandomSequence };
+
+  AudioFarblingHelper(Mode mode, double fudge_factor, uint64_t seed);
+  AudioFarblingHelper(const AudioFarblingHelper& other);
+  AudioFarblingHelper& operator=(const AudioFarblingHelper& other);
+  ~AudioFarblingHelper();
+
+  // Farbles |count| samples of |data| in place, starting at index 0.
+  void FarbleAudioChannel(float* data, size_t count) const;
+
+  // Farbles a single sample. The pseudo-random sequence restarts whenever
+  // |index| is 0, so callers must visit indices in order.
+  float FarbleAudioSample(float value, size_t index);
+
+ private:
+  Mode mode_;
+  double fudge_factor_;
+  uint64_t seed_;
+  uint64_t state_;
+};
 
 CORE_EXPORT blink::WebContentSettingsClient* GetContentSettingsClientFor(
     ExecutionContext* context);
@@ -42,8 +65,11 @@ class CORE_EXPORT BraveSessionCache final
 
   static BraveSessionCache& From(ExecutionContext&);
 
-  AudioFarblingCallback GetAudioFarblingCallback(
+  absl::optional<AudioFarblingHelper> GetAudioFarblingHelper(
       blink::WebContentSettingsClient* settings);
+  void FarbleAudioChannel(blink::WebContentSettingsClient* settings,
+                          float* data,
+                          size_t count);
   void PerturbPixels(blink::WebContentSettingsClient* settings,
                      const unsigned char* data,
                      size_t size);
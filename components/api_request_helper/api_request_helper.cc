@@ -7,6 +7,10 @@
 
 #include <utility>
 
+#include "base/bind.h"
+#include "base/json/json_reader.h"
+#include "base/strings/string_util.h"
+#include "base/task/thread_pool.h"
 #include "net/base/load_flags.h"
 #include "services/network/public/cpp/shared_url_loader_factory.h"
 #include "services/network/public/cpp/simple_url_loader.h"
@@ -15,6 +19,26 @@ namespace api_request_helper {
 
 const unsigned int kRetriesCountOnNetworkChange = 1;
 
+namespace {
+
+base::Value ParseJSON(std::unique_ptr<std::string> response_body) {
+  absl::optional<base::Value> value = base::JSONReader::Read(
+      *response_body, base::JSONParserOptions::JSON_PARSE_RFC);
+  if (!value)
+    return base::Value();
+  return std::move(*value);
+}
+
+void RunJSONResultCallback(
+    APIRequestHelper::JSONResultCallback callback,
+    const int response_code,
+    const std::map<std::string, std::string>& headers,
+    base::Value value) {
+  std::move(callback).Run(response_code, std::move(value), headers);
+}
+
+}  // namespace
+
 APIRequestHelper::APIRequestHelper(
     net::NetworkTrafficAnnotationTag annotation_tag,
     scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory)
@@ -29,6 +53,36 @@ void APIRequestHelper::Request(const std::string& method,
                                const std::string& payload_content_type,
                                bool auto_retry_on_network_change,
                                ResultCallback callback) {
+  auto iter = CreateLoader(method, url, payload, payload_content_type,
+                           auto_retry_on_network_change);
+  iter->get()->DownloadToStringOfUnboundedSizeUntilCrashAndDie(
+      url_loader_factory_.get(),
+      base::BindOnce(&APIRequestHelper::OnResponse, base::Unretained(this),
+                     iter, std::move(callback)));
+}
+
+void APIRequestHelper::RequestJSON(const std::string& method,
+                                   const GURL& url,
+                                   const std::string& payload,
+                                   const std::string& payload_content_type,
+                                   bool auto_retry_on_network_change,
+                                   size_t max_body_size,
+                                   JSONResultCallback callback) {
+  auto iter = CreateLoader(method, url, payload, payload_content_type,
+                           auto_retry_on_network_change);
+  iter->get()->DownloadToString(
+      url_loader_factory_.get(),
+      base::BindOnce(&APIRequestHelper::OnJSONResponse, base::Unretained(this),
+                     iter, std::move(callback)),
+      max_body_size);
+}
+
+APIRequestHelper::SimpleURLLoaderList::iterator APIRequestHelper::CreateLoader(
+    const std::string& method,
+    const GURL& url,
+    const std::string& payload,
+    const std::string& payload_content_type,
+    bool auto_retry_on_network_change) {
   auto request = std::make_unique<network::ResourceRequest>();
   request->url = url;
   request->load_flags = net::LOAD_BYPASS_CACHE | net::LOAD_DISABLE_CACHE |
@@ -46,20 +100,14 @@ void APIRequestHelper::Request(const std::string& method,
       auto_retry_on_network_change
           ? network::SimpleURLLoader::RetryMode::RETRY_ON_NETWORK_CHANGE
           : network::SimpleURLLoader::RetryMode::RETRY_NEVER);
-  auto iter = url_loaders_.insert(url_loaders_.begin(), std::move(url_loader));
-  iter->get()->DownloadToStringOfUnboundedSizeUntilCrashAndDie(
-      url_loader_factory_.get(),
-      base::BindOnce(&APIRequestHelper::OnResponse, base::Unretained(this),
-                     iter, std::move(callback)));
+  return url_loaders_.insert(url_loaders_.begin(), std::move(url_loader));
 }
 
-void APIRequestHelper::OnResponse(
+int APIRequestHelper::TakeResponseInfo(
     SimpleURLLoaderList::iterator iter,
-    ResultCallback callback,
-    const std::unique_ptr<std::string> response_body) {
+    std::map<std::string, std::string>* headers) {
   auto* loader = iter->get();
   auto response_code = -1;
-  std::map<std::string, std::string> headers;
   if (loader->ResponseInfo()) {
     auto headers_list = loader->ResponseInfo()->headers;
     if (headers_list) {
@@ -69,13 +117,40 @@ void APIRequestHelper::OnResponse(
       std::string value;
       while (headers_list->EnumerateHeaderLines(&iter, &key, &value)) {
         key = base::ToLowerASCII(key);
-        headers[key] = value;
+        (*headers)[key] = value;
       }
     }
   }
   url_loaders_.erase(iter);
+  return response_code;
+}
+
+void APIRequestHelper::OnResponse(
+    SimpleURLLoaderList::iterator iter,
+    ResultCallback callback,
+    const std::unique_ptr<std::string> response_body) {
+  std::map<std::string, std::string> headers;
+  const int response_code = TakeResponseInfo(iter, &headers);
   std::move(callback).Run(response_code, response_body ? *response_body : "",
                           headers);
 }
 
+void APIRequestHelper::OnJSONResponse(
+    SimpleURLLoaderList::iterator iter,
+    JSONResultCallback callback,
+    std::unique_ptr<std::string> response_body) {
+  std::map<std::string, std::string> headers;
+  const int response_code = TakeResponseInfo(iter, &headers);
+  if (!response_body) {
+    std::move(callback).Run(response_code, base::Value(), headers);
+    return;
+  }
+
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::TaskPriority::USER_VISIBLE},
+      base::BindOnce(&ParseJSON, std::move(response_body)),
+      base::BindOnce(&RunJSONResultCallback, std::move(callback),
+                     response_code, std::move(headers)));
+}
+
 }  // namespace api_request_helper
@@ -12,6 +12,7 @@
 #include <string>
 
 #include "base/callback.h"
+#include "base/values.h"
 #include "net/traffic_annotation/network_traffic_annotation.h"
 #include "url/gurl.h"
 
@@ -41,14 +42,42 @@ class APIRequestHelper {
                bool auto_retry_on_network_change,
                ResultCallback callback);
 
+  // Like Request, but the response body is capped at |max_body_size| bytes
+  // and parsed as JSON on a worker thread. |callback| still runs on the
+  // calling sequence. It gets a NONE value if the body is missing, larger
+  // than |max_body_size| or not valid JSON.
+  using JSONResultCallback =
+      base::OnceCallback<void(const int,
+                              base::Value,
+                              const std::map<std::string, std::string>&)>;
+  void RequestJSON(const std::string& method,
+                   const GURL& url,
+                   const std::string& payload,
+                   const std::string& payload_content_type,
+                   bool auto_retry_on_network_change,
+                   size_t max_body_size,
+                   JSONResultCallback callback);
+
  private:
   APIRequestHelper(const APIRequestHelper&) = delete;
   APIRequestHelper& operator=(const APIRequestHelper&) = delete;
   using SimpleURLLoaderList =
       std::list<std::unique_ptr<network::SimpleURLLoader>>;
+  SimpleURLLoaderList::iterator CreateLoader(
+      const std::string& method,
+      const GURL& url,
+      const std::string& payload,
+      const std::string& payload_content_type,
+      bool auto_retry_on_network_change);
+  // Reads the response code and headers, then destroys the loader.
+  int TakeResponseInfo(SimpleURLLoaderList::iterator iter,
+                       std::map<std::string, std::string>* headers);
   void OnResponse(SimpleURLLoaderList::iterator iter,
                   ResultCallback callback,
                   const std::unique_ptr<std::string> response_body);
+  void OnJSONResponse(SimpleURLLoaderList::iterator iter,
+                      JSONResultCallback callback,
+                      std::unique_ptr<std::string> response_body);
 
   net::NetworkTrafficAnnotationTag annotation_tag_;
   SimpleURLLoaderList url_loaders_;
@@ -0,0 +1,78 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/api_request_helper/api_request_helper.h"
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "base/run_loop.h"
+#include "base/test/bind.h"
+#include "base/test/task_environment.h"
+#include "net/http/http_status_code.h"
+#include "net/traffic_annotation/network_traffic_annotation_test_helper.h"
+#include "services/network/public/cpp/weak_wrapper_shared_url_loader_factory.h"
+#include "services/network/test/test_url_loader_factory.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace api_request_helper {
+
+class APIRequestHelperUnitTest : public testing::Test {
+ public:
+  APIRequestHelperUnitTest()
+      : shared_url_loader_factory_(
+            base::MakeRefCounted<network::WeakWrapperSharedURLLoaderFactory>(
+                &url_loader_factory_)),
+        api_request_helper_(TRAFFIC_ANNOTATION_FOR_TESTS,
+                            shared_url_loader_factory_) {}
+
+  // Returns the parsed value handed to the JSON callback.
+  base::Value RequestJSON(const std::string& response, size_t max_body_size) {
+    url_loader_factory_.AddResponse(kTestURL, response);
+
+    base::Value result;
+    int result_code = 0;
+    base::RunLoop run_loop;
+    api_request_helper_.RequestJSON(
+        "GET", GURL(kTestURL), "", "", false, max_body_size,
+        base::BindLambdaForTesting(
+            [&](const int code, base::Value value,
+                const std::map<std::string, std::string>& headers) {
+              result_code = code;
+              result = std::move(value);
+              run_loop.Quit();
+            }));
+    run_loop.Run();
+    EXPECT_EQ(result_code, net::HTTP_OK);
+    return result;
+  }
+
+ protected:
+  static constexpr char kTestURL[] = "https://brave.com/api";
+
+  base::test::TaskEnvironment task_environment_;
+  network::TestURLLoaderFactory url_loader_factory_;
+  scoped_refptr<network::SharedURLLoaderFactory> shared_url_loader_factory_;
+  APIRequestHelper api_request_helper_;
+};
+
+TEST_F(APIRequestHelperUnitTest, RequestJSON) {
+  base::Value value = RequestJSON(R"({"result": [1, 2]})", 1024);
+  ASSERT_TRUE(value.is_dict());
+  const base::Value* result = value.FindListKey("result");
+  ASSERT_TRUE(result);
+  EXPECT_EQ(result->GetList().size(), 2u);
+
+  // Invalid JSON
+  EXPECT_TRUE(RequestJSON("{\"result\": ", 1024).is_none());
+
+  // Body larger than the cap
+  const std::string large_body = "[\"" + std::string(4096, 'a') + "\"]";
+  EXPECT_TRUE(RequestJSON(large_body, 1024).is_none());
+  EXPECT_TRUE(RequestJSON(large_body, large_body.size()).is_list());
+}
+
+}  // namespace api_request_helper
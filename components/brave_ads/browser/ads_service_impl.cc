@@ -7,7 +7,9 @@
 
 #include <algorithm>
 #include <limits>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "base/base64.h"
 #include "base/bind.h"
@@ -27,6 +29,7 @@
 #include "base/path_service.h"
 #include "base/sequenced_task_runner.h"
 #include "base/strings/string_number_conversions.h"
+#include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/task/post_task.h"
 #include "base/task/thread_pool.h"
@@ -782,7 +785,22 @@ void AdsServiceImpl::Stop() {
 void AdsServiceImpl::ResetState() {
   VLOG(1) << "Resetting ads state";
 
-  profile_->GetPrefs()->ClearPrefsWithPrefixSilently("brave.brave_ads");
+  const std::string prefix = "brave.brave_ads";
+  std::vector<std::string> paths;
+  profile_->GetPrefs()->IteratePreferenceValues(base::BindRepeating(
+      [](const std::string& prefix, std::vector<std::string>* paths,
+         const std::string& path, const base::Value& value) {
+        if (base::StartsWith(path, prefix))
+          paths->push_back(path);
+      },
+      prefix, &paths));
+
+  profile_->GetPrefs()->ClearPrefsWithPrefixSilently(prefix);
+
+  // Prefs are cleared silently, so tell bat_ads to drop its cached values
+  for (const auto& path : paths) {
+    OnPrefChanged(path);
+  }
 
   base::PostTaskAndReplyWithResult(
       file_task_runner_.get(), FROM_HERE,
@@ -1374,6 +1392,19 @@ void AdsServiceImpl::OnLoaded(const ads::LoadCallback& callback,
     callback(ads::Result::SUCCESS, value);
 }
 
+void AdsServiceImpl::OnLoadedAdsResource(
+    const ads::LoadAdsResourceCallback& callback,
+    const std::string& value) {
+  if (!connected()) {
+    return;
+  }
+
+  if (value.empty())
+    callback(ads::Result::FAILED, value);
+  else
+    callback(ads::Result::SUCCESS, value);
+}
+
 void AdsServiceImpl::OnSaved(const ads::ResultCallback& callback,
                              const bool success) {
   if (!connected()) {
@@ -1745,6 +1776,12 @@ bool AdsServiceImpl::PrefExists(const std::string& path) const {
 }
 
 void AdsServiceImpl::OnPrefsChanged(const std::string& pref) {
+  if (pref == ads::prefs::kEnabled || pref == ads::prefs::kIdleTimeThreshold) {
+    // These can change without going through the ads client pref setters, so
+    // let bat ads drop its mirrored value
+    OnPrefChanged(pref);
+  }
+
   if (pref == ads::prefs::kEnabled || pref == kBraveTodayOptedIn) {
     if (pref == ads::prefs::kEnabled) {
       rewards_service_->OnAdsEnabled(IsEnabled());
@@ -1996,7 +2033,7 @@ void AdsServiceImpl::Save(const std::string& name,
 
 void AdsServiceImpl::LoadAdsResource(const std::string& id,
                                      const int version,
-                                     ads::LoadCallback callback) {
+                                     ads::LoadAdsResourceCallback callback) {
   const absl::optional<base::FilePath> path =
       g_brave_browser_process->resource_component()->GetPath(id, version);
 
@@ -2010,7 +2047,7 @@ void AdsServiceImpl::LoadAdsResource(const std::string& id,
   base::PostTaskAndReplyWithResult(
       file_task_runner_.get(), FROM_HERE,
       base::BindOnce(&LoadOnFileTaskRunner, path.value()),
-      base::BindOnce(&AdsServiceImpl::OnLoaded, AsWeakPtr(),
+      base::BindOnce(&AdsServiceImpl::OnLoadedAdsResource, AsWeakPtr(),
                      std::move(callback)));
 }
 
@@ -288,6 +288,8 @@ class AdsServiceImpl : public AdsService,
                       const bool flagged);
 
   void OnLoaded(const ads::LoadCallback& callback, const std::string& value);
+  void OnLoadedAdsResource(const ads::LoadAdsResourceCallback& callback,
+                           const std::string& value);
   void OnSaved(const ads::ResultCallback& callback, const bool success);
 
   void OnRunDBTransaction(ads::RunDBTransactionCallback callback,
@@ -368,7 +370,7 @@ class AdsServiceImpl : public AdsService,
 
   void LoadAdsResource(const std::string& id,
                        const int version,
-                       ads::LoadCallback callback) override;
+                       ads::LoadAdsResourceCallback callback) override;
 
   void GetBrowsingHistory(const int max_count,
                           const int days_ago,
@@ -9,5 +9,6 @@ namespace brave_wallet {
 
 const char kAssetRatioBaseURL[] = "https://ratios.rewards.brave.com/";
 const char kSwapBaseURL[] = "https://api.0x.org/";
+const char kTransactionsFileName[] = "Brave Wallet Transactions";
 
 }  // namespace brave_wallet
@@ -28,6 +28,7 @@ enum class Network {
 
 extern const char kAssetRatioBaseURL[];
 extern const char kSwapBaseURL[];
+extern const char kTransactionsFileName[];
 
 }  // namespace brave_wallet
 
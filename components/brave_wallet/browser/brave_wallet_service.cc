@@ -5,6 +5,8 @@
 
 #include "brave/components/brave_wallet/browser/brave_wallet_service.h"
 
+#include <utility>
+
 #include "brave/components/brave_wallet/browser/asset_ratio_controller.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
@@ -13,6 +15,7 @@
 #include "brave/components/brave_wallet/browser/keyring_controller.h"
 #include "brave/components/brave_wallet/browser/pref_names.h"
 #include "brave/components/brave_wallet/browser/swap_controller.h"
+#include "components/prefs/persistent_pref_store.h"
 #include "components/prefs/pref_registry_simple.h"
 #include "components/prefs/pref_service.h"
 #include "services/network/public/cpp/shared_url_loader_factory.h"
@@ -21,6 +24,7 @@ namespace brave_wallet {
 
 BraveWalletService::BraveWalletService(
     PrefService* prefs,
+    scoped_refptr<PersistentPrefStore> tx_store,
     scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory)
     : prefs_(prefs) {
   rpc_controller_ = std::make_unique<brave_wallet::EthJsonRpcController>(
@@ -28,7 +32,7 @@ BraveWalletService::BraveWalletService(
   keyring_controller_ =
       std::make_unique<brave_wallet::KeyringController>(prefs);
   tx_controller_ = std::make_unique<brave_wallet::EthTxController>(
-      base::AsWeakPtr(this), prefs);
+      base::AsWeakPtr(this), prefs, std::move(tx_store));
   asset_ratio_controller_ =
       std::make_unique<brave_wallet::AssetRatioController>(url_loader_factory);
   swap_controller_ =
@@ -12,6 +12,7 @@
 #include "base/memory/weak_ptr.h"
 #include "components/keyed_service/core/keyed_service.h"
 
+class PersistentPrefStore;
 class PrefService;
 class PrefRegistrySimple;
 
@@ -30,8 +31,10 @@ class SwapController;
 class BraveWalletService : public KeyedService,
                            public base::SupportsWeakPtr<BraveWalletService> {
  public:
-  explicit BraveWalletService(
+  // |tx_store| holds the wallet's transaction history.
+  BraveWalletService(
       PrefService* prefs,
+      scoped_refptr<PersistentPrefStore> tx_store,
       scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory);
   ~BraveWalletService() override;
 
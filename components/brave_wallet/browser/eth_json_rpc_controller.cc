@@ -5,10 +5,13 @@
 
 #include "brave/components/brave_wallet/browser/eth_json_rpc_controller.h"
 
+#include <map>
+#include <string>
 #include <utility>
 
 #include "base/environment.h"
 #include "base/strings/stringprintf.h"
+#include "base/threading/sequenced_task_runner_handle.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
 #include "brave/components/brave_wallet/browser/eth_call_data_builder.h"
 #include "brave/components/brave_wallet/browser/eth_requests.h"
@@ -17,6 +20,11 @@
 
 namespace {
 
+// Responses to the wallet's own requests are small. Batches of receipts are
+// the largest, so this leaves plenty of room while bounding what a node can
+// make the browser buffer and parse.
+const size_t kMaxResponseBodySize = 4 * 1024 * 1024;
+
 net::NetworkTrafficAnnotationTag GetNetworkTrafficAnnotationTag() {
   return net::DefineNetworkTrafficAnnotation("eth_json_rpc_controller", R"(
       semantics {
@@ -92,6 +100,62 @@ void EthJsonRpcController::Request(const std::string& json_payload,
                               std::move(callback));
 }
 
+void EthJsonRpcController::RequestJSON(const std::string& json_payload,
+                                       JSONRequestCallback callback,
+                                       bool auto_retry_on_network_change) {
+  api_request_helper_.RequestJSON("POST", network_url_, json_payload,
+                                  "application/json",
+                                  auto_retry_on_network_change,
+                                  kMaxResponseBodySize, std::move(callback));
+}
+
+void EthJsonRpcController::BatchRequest(
+    const std::vector<std::string>& json_payloads,
+    std::vector<JSONRequestCallback> callbacks,
+    bool auto_retry_on_network_change) {
+  DCHECK_EQ(json_payloads.size(), callbacks.size());
+  if (json_payloads.empty())
+    return;
+  if (json_payloads.size() == 1) {
+    RequestJSON(json_payloads.front(), std::move(callbacks.front()),
+                auto_retry_on_network_change);
+    return;
+  }
+
+  const std::string batch = GetJsonRpcBatch(json_payloads);
+  if (batch.empty()) {
+    // Fail every request asynchronously, as a failed network request would.
+    base::SequencedTaskRunnerHandle::Get()->PostTask(
+        FROM_HERE,
+        base::BindOnce(&EthJsonRpcController::OnBatchRequest,
+                       weak_ptr_factory_.GetWeakPtr(), std::move(callbacks),
+                       -1, base::Value(),
+                       std::map<std::string, std::string>()));
+    return;
+  }
+  api_request_helper_.RequestJSON(
+      "POST", network_url_, batch, "application/json",
+      auto_retry_on_network_change, kMaxResponseBodySize,
+      base::BindOnce(&EthJsonRpcController::OnBatchRequest,
+                     weak_ptr_factory_.GetWeakPtr(), std::move(callbacks)));
+}
+
+void EthJsonRpcController::OnBatchRequest(
+    std::vector<JSONRequestCallback> callbacks,
+    const int status,
+    base::Value batch,
+    const std::map<std::string, std::string>& headers) {
+  // A body that is not a batch response, such as a single error object,
+  // fails every request in the batch.
+  std::vector<base::Value> responses;
+  if (status >= 200 && status <= 299)
+    ParseJsonRpcBatchResponse(std::move(batch), callbacks.size(), &responses);
+  responses.resize(callbacks.size());
+
+  for (size_t i = 0; i < callbacks.size(); ++i)
+    std::move(callbacks[i]).Run(status, std::move(responses[i]), headers);
+}
+
 Network EthJsonRpcController::GetNetwork() const {
   return network_;
 }
@@ -149,21 +213,21 @@ void EthJsonRpcController::GetBalance(
   auto internal_callback =
       base::BindOnce(&EthJsonRpcController::OnGetBalance,
                      weak_ptr_factory_.GetWeakPtr(), std::move(callback));
-  return Request(eth_getBalance(address, "latest"),
-                 std::move(internal_callback), true);
+  return RequestJSON(eth_getBalance(address, "latest"),
+                     std::move(internal_callback), true);
 }
 
 void EthJsonRpcController::OnGetBalance(
     GetBallanceCallback callback,
     const int status,
-    const std::string& body,
+    base::Value response,
     const std::map<std::string, std::string>& headers) {
   if (status < 200 || status > 299) {
     std::move(callback).Run(false, "");
     return;
   }
   std::string balance;
-  if (!ParseEthGetBalance(body, &balance)) {
+  if (!ParseEthGetBalance(response, &balance)) {
     std::move(callback).Run(false, "");
     return;
   }
@@ -176,21 +240,21 @@ void EthJsonRpcController::GetTransactionCount(const std::string& address,
   auto internal_callback =
       base::BindOnce(&EthJsonRpcController::OnGetTransactionCount,
                      weak_ptr_factory_.GetWeakPtr(), std::move(callback));
-  return Request(eth_getTransactionCount(address, "latest"),
-                 std::move(internal_callback), true);
+  return RequestJSON(eth_getTransactionCount(address, "latest"),
+                     std::move(internal_callback), true);
 }
 
 void EthJsonRpcController::OnGetTransactionCount(
     GetTxCountCallback callback,
     const int status,
-    const std::string& body,
+    base::Value response,
     const std::map<std::string, std::string>& headers) {
   if (status < 200 || status > 299) {
     std::move(callback).Run(false, 0);
     return;
   }
   uint256_t count;
-  if (!ParseEthGetTransactionCount(body, &count)) {
+  if (!ParseEthGetTransactionCount(response, &count)) {
     std::move(callback).Run(false, 0);
     return;
   }
@@ -204,21 +268,38 @@ void EthJsonRpcController::GetTransactionReceipt(
   auto internal_callback =
       base::BindOnce(&EthJsonRpcController::OnGetTransactionReceipt,
                      weak_ptr_factory_.GetWeakPtr(), std::move(callback));
-  return Request(eth_getTransactionReceipt(tx_hash),
-                 std::move(internal_callback), true);
+  return RequestJSON(eth_getTransactionReceipt(tx_hash),
+                     std::move(internal_callback), true);
+}
+
+void EthJsonRpcController::GetTransactionReceipts(
+    const std::vector<std::string>& tx_hashes,
+    std::vector<GetTxReceiptCallback> callbacks) {
+  DCHECK_EQ(tx_hashes.size(), callbacks.size());
+  std::vector<std::string> payloads;
+  std::vector<JSONRequestCallback> internal_callbacks;
+  payloads.reserve(tx_hashes.size());
+  internal_callbacks.reserve(tx_hashes.size());
+  for (size_t i = 0; i < tx_hashes.size(); ++i) {
+    payloads.push_back(eth_getTransactionReceipt(tx_hashes[i]));
+    internal_callbacks.push_back(
+        base::BindOnce(&EthJsonRpcController::OnGetTransactionReceipt,
+                       weak_ptr_factory_.GetWeakPtr(), std::move(callbacks[i])));
+  }
+  BatchRequest(payloads, std::move(internal_callbacks), true);
 }
 
 void EthJsonRpcController::OnGetTransactionReceipt(
     GetTxReceiptCallback callback,
     const int status,
-    const std::string& body,
+    base::Value response,
     const std::map<std::string, std::string>& headers) {
   TransactionReceipt receipt;
   if (status < 200 || status > 299) {
     std::move(callback).Run(false, receipt);
     return;
   }
-  if (!ParseEthGetTransactionReceipt(body, &receipt)) {
+  if (!ParseEthGetTransactionReceipt(response, &receipt)) {
     std::move(callback).Run(false, receipt);
     return;
   }
@@ -231,21 +312,38 @@ void EthJsonRpcController::SendRawTransaction(const std::string& signed_tx,
   auto internal_callback =
       base::BindOnce(&EthJsonRpcController::OnSendRawTransaction,
                      weak_ptr_factory_.GetWeakPtr(), std::move(callback));
-  return Request(eth_sendRawTransaction(signed_tx),
-                 std::move(internal_callback), true);
+  return RequestJSON(eth_sendRawTransaction(signed_tx),
+                     std::move(internal_callback), true);
+}
+
+void EthJsonRpcController::SendRawTransactions(
+    const std::vector<std::string>& signed_txs,
+    std::vector<SendRawTxCallback> callbacks) {
+  DCHECK_EQ(signed_txs.size(), callbacks.size());
+  std::vector<std::string> payloads;
+  std::vector<JSONRequestCallback> internal_callbacks;
+  payloads.reserve(signed_txs.size());
+  internal_callbacks.reserve(signed_txs.size());
+  for (size_t i = 0; i < signed_txs.size(); ++i) {
+    payloads.push_back(eth_sendRawTransaction(signed_txs[i]));
+    internal_callbacks.push_back(
+        base::BindOnce(&EthJsonRpcController::OnSendRawTransaction,
+                       weak_ptr_factory_.GetWeakPtr(), std::move(callbacks[i])));
+  }
+  BatchRequest(payloads, std::move(internal_callbacks), true);
 }
 
 void EthJsonRpcController::OnSendRawTransaction(
     SendRawTxCallback callback,
     const int status,
-    const std::string& body,
+    base::Value response,
     const std::map<std::string, std::string>& headers) {
   if (status < 200 || status > 299) {
     std::move(callback).Run(false, "");
     return;
   }
   std::string tx_hash;
-  if (!ParseEthSendRawTransaction(body, &tx_hash)) {
+  if (!ParseEthSendRawTransaction(response, &tx_hash)) {
     std::move(callback).Run(false, "");
     return;
   }
@@ -264,22 +362,22 @@ bool EthJsonRpcController::GetERC20TokenBalance(
   if (!erc20::BalanceOf(address, &data)) {
     return false;
   }
-  Request(eth_call("", address, "", "", "", data, ""),
-          std::move(internal_callback), true);
+  RequestJSON(eth_call("", address, "", "", "", data, ""),
+              std::move(internal_callback), true);
   return true;
 }
 
 void EthJsonRpcController::OnGetERC20TokenBalance(
     GetERC20TokenBalanceCallback callback,
     const int status,
-    const std::string& body,
+    base::Value response,
     const std::map<std::string, std::string>& headers) {
   if (status < 200 || status > 299) {
     std::move(callback).Run(false, "");
     return;
   }
   std::string result;
-  if (!ParseEthCall(body, &result)) {
+  if (!ParseEthCall(response, &result)) {
     std::move(callback).Run(false, "");
     return;
   }
@@ -299,15 +397,15 @@ bool EthJsonRpcController::EnsProxyReaderResolveAddress(
     return false;
   }
 
-  Request(eth_call("", contract_address, "", "", "", data, "latest"),
-          std::move(internal_callback), true);
+  RequestJSON(eth_call("", contract_address, "", "", "", data, "latest"),
+              std::move(internal_callback), true);
   return true;
 }
 
 void EthJsonRpcController::OnEnsProxyReaderResolveAddress(
     UnstoppableDomainsProxyReaderGetManyCallback callback,
     int status,
-    const std::string& body,
+    base::Value response,
     const std::map<std::string, std::string>& headers) {
   DCHECK(callback);
   if (status < 200 || status > 299) {
@@ -315,7 +413,7 @@ void EthJsonRpcController::OnEnsProxyReaderResolveAddress(
     return;
   }
   std::string result;
-  if (!ParseEthCall(body, &result)) {
+  if (!ParseEthCall(response, &result)) {
     std::move(callback).Run(false, "");
     return;
   }
@@ -335,22 +433,22 @@ bool EthJsonRpcController::UnstoppableDomainsProxyReaderGetMany(
     return false;
   }
 
-  Request(eth_call("", contract_address, "", "", "", data, "latest"),
-          std::move(internal_callback), true);
+  RequestJSON(eth_call("", contract_address, "", "", "", data, "latest"),
+              std::move(internal_callback), true);
   return true;
 }
 
 void EthJsonRpcController::OnUnstoppableDomainsProxyReaderGetMany(
     UnstoppableDomainsProxyReaderGetManyCallback callback,
     const int status,
-    const std::string& body,
+    base::Value response,
     const std::map<std::string, std::string>& headers) {
   if (status < 200 || status > 299) {
     std::move(callback).Run(false, "");
     return;
   }
   std::string result;
-  if (!ParseEthCall(body, &result)) {
+  if (!ParseEthCall(response, &result)) {
     std::move(callback).Run(false, "");
     return;
   }
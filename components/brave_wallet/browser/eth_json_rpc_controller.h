@@ -42,6 +42,22 @@ class EthJsonRpcController {
   void Request(const std::string& json_payload,
                URLRequestCallback callback,
                bool auto_retry_on_network_change);
+  // Like Request, but the response is parsed off the UI thread and handed to
+  // |callback| as a base::Value. It is NONE if the body is not valid JSON or
+  // is too large.
+  using JSONRequestCallback =
+      api_request_helper::APIRequestHelper::JSONResultCallback;
+  void RequestJSON(const std::string& json_payload,
+                   JSONRequestCallback callback,
+                   bool auto_retry_on_network_change);
+  // Sends |json_payloads| as one JSON-RPC 2.0 batch and runs each of
+  // |callbacks| with the response to the payload at the same index, as if it
+  // had been sent on its own through RequestJSON. Payloads the node did not
+  // answer get a NONE value.
+  void BatchRequest(const std::vector<std::string>& json_payloads,
+                    std::vector<JSONRequestCallback> callbacks,
+                    bool auto_retry_on_network_change);
+
   using GetBallanceCallback =
       base::OnceCallback<void(bool status, const std::string& balance)>;
   void GetBalance(const std::string& address, GetBallanceCallback callback);
@@ -55,11 +71,17 @@ class EthJsonRpcController {
       base::OnceCallback<void(bool status, TransactionReceipt result)>;
   void GetTransactionReceipt(const std::string& tx_hash,
                              GetTxReceiptCallback callback);
+  // Batched form of GetTransactionReceipt(), one callback per hash.
+  void GetTransactionReceipts(const std::vector<std::string>& tx_hashes,
+                              std::vector<GetTxReceiptCallback> callbacks);
 
   using SendRawTxCallback =
       base::OnceCallback<void(bool status, const std::string& tx_hash)>;
   void SendRawTransaction(const std::string& signed_tx,
                           SendRawTxCallback callback);
+  // Batched form of SendRawTransaction(), one callback per transaction.
+  void SendRawTransactions(const std::vector<std::string>& signed_txs,
+                           std::vector<SendRawTxCallback> callbacks);
 
   using GetERC20TokenBalanceCallback =
       base::OnceCallback<void(bool status, const std::string& balance)>;
@@ -96,39 +118,43 @@ class EthJsonRpcController {
   static GURL GetBlockTrackerURLFromNetwork(Network network);
 
  private:
+  void OnBatchRequest(std::vector<JSONRequestCallback> callbacks,
+                      const int status,
+                      base::Value batch,
+                      const std::map<std::string, std::string>& headers);
   void OnGetBalance(GetBallanceCallback callback,
                     const int status,
-                    const std::string& body,
+                    base::Value response,
                     const std::map<std::string, std::string>& headers);
   void OnGetTransactionCount(GetTxCountCallback callback,
                              const int status,
-                             const std::string& body,
+                             base::Value response,
                              const std::map<std::string, std::string>& headers);
   void OnGetTransactionReceipt(
       GetTxReceiptCallback callback,
       const int status,
-      const std::string& body,
+      base::Value response,
       const std::map<std::string, std::string>& headers);
   void OnSendRawTransaction(SendRawTxCallback callback,
                             const int status,
-                            const std::string& body,
+                            base::Value response,
                             const std::map<std::string, std::string>& headers);
   void OnGetERC20TokenBalance(
       GetERC20TokenBalanceCallback callback,
       const int status,
-      const std::string& body,
+      base::Value response,
       const std::map<std::string, std::string>& headers);
 
   void OnUnstoppableDomainsProxyReaderGetMany(
       UnstoppableDomainsProxyReaderGetManyCallback callback,
       const int status,
-      const std::string& body,
+      base::Value response,
       const std::map<std::string, std::string>& headers);
 
   void OnEnsProxyReaderResolveAddress(
       UnstoppableDomainsProxyReaderGetManyCallback callback,
       int status,
-      const std::string& body,
+      base::Value response,
       const std::map<std::string, std::string>& headers);
 
   api_request_helper::APIRequestHelper api_request_helper_;
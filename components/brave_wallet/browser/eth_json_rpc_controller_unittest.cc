@@ -4,14 +4,21 @@
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
 #include <memory>
+#include <string>
+#include <utility>
 #include <vector>
 
+#include "base/run_loop.h"
+#include "base/test/bind.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
 #include "brave/components/brave_wallet/browser/eth_json_rpc_controller.h"
+#include "brave/components/brave_wallet/browser/eth_requests.h"
 #include "content/public/browser/storage_partition.h"
 #include "content/public/test/browser_task_environment.h"
 #include "content/public/test/test_browser_context.h"
+#include "services/network/public/cpp/weak_wrapper_shared_url_loader_factory.h"
 #include "services/network/test/test_shared_url_loader_factory.h"
+#include "services/network/test/test_url_loader_factory.h"
 #include "testing/gtest/include/gtest/gtest.h"
 #include "url/gurl.h"
 
@@ -33,6 +40,10 @@ class EthJsonRpcControllerUnitTest : public testing::Test {
 
   content::TestBrowserContext* context() { return browser_context_.get(); }
 
+ protected:
+  // Stands in for the Ethereum node.
+  network::TestURLLoaderFactory url_loader_factory_;
+
  private:
   scoped_refptr<network::TestSharedURLLoaderFactory> shared_url_loader_factory_;
   content::BrowserTaskEnvironment task_environment_;
@@ -85,4 +96,83 @@ TEST_F(EthJsonRpcControllerUnitTest, SetCustomNetwork) {
   ASSERT_EQ(controller.GetNetworkURL(), custom_network);
 }
 
+TEST_F(EthJsonRpcControllerUnitTest, GetTransactionReceiptsBatch) {
+  EthJsonRpcController controller(
+      Network::kLocalhost,
+      base::MakeRefCounted<network::WeakWrapperSharedURLLoaderFactory>(
+          &url_loader_factory_));
+  int request_count = 0;
+  std::string request_body;
+  url_loader_factory_.SetInterceptor(base::BindLambdaForTesting(
+      [&](const network::ResourceRequest& request) {
+        request_count++;
+        request_body = std::string(request.request_body->elements()
+                                       ->at(0)
+                                       .As<network::DataElementBytes>()
+                                       .AsStringPiece());
+      }));
+  // The second transaction has no receipt yet and the third fails.
+  url_loader_factory_.AddResponse(controller.GetNetworkURL().spec(), R"([
+      {"jsonrpc":"2.0","id":2,"error":{"code":-32000,"message":"failed"}},
+      {"jsonrpc":"2.0","id":1,"result":null},
+      {"jsonrpc":"2.0","id":0,"result":{
+        "transactionHash":"0x1",
+        "transactionIndex":"0x1",
+        "blockNumber":"0xb",
+        "blockHash":"0xb",
+        "cumulativeGasUsed":"0x33bc",
+        "gasUsed":"0x4dc",
+        "contractAddress":null,
+        "logs":[],
+        "logsBloom":"0x00...0",
+        "status":"0x1"}}
+    ])");
+
+  std::vector<bool> statuses(3, true);
+  std::vector<EthJsonRpcController::GetTxReceiptCallback> callbacks;
+  for (size_t i = 0; i < 3; ++i) {
+    callbacks.push_back(base::BindLambdaForTesting(
+        [&statuses, i](bool status, TransactionReceipt receipt) {
+          statuses[i] = status;
+          if (status)
+            EXPECT_EQ(receipt.transaction_hash, "0x1");
+        }));
+  }
+  controller.GetTransactionReceipts({"0x1", "0x2", "0x3"},
+                                    std::move(callbacks));
+  base::RunLoop().RunUntilIdle();
+
+  EXPECT_EQ(request_count, 1);
+  EXPECT_EQ(request_body,
+            GetJsonRpcBatch({eth_getTransactionReceipt("0x1"),
+                             eth_getTransactionReceipt("0x2"),
+                             eth_getTransactionReceipt("0x3")}));
+  EXPECT_EQ(statuses, std::vector<bool>({true, false, false}));
+}
+
+TEST_F(EthJsonRpcControllerUnitTest, SendRawTransactionsBatchNotSupported) {
+  EthJsonRpcController controller(
+      Network::kLocalhost,
+      base::MakeRefCounted<network::WeakWrapperSharedURLLoaderFactory>(
+          &url_loader_factory_));
+  // A node without batch support answers with a single error object.
+  url_loader_factory_.AddResponse(
+      controller.GetNetworkURL().spec(),
+      R"({"jsonrpc":"2.0","id":null,"error":{"code":-32600}})");
+
+  int failures = 0;
+  std::vector<EthJsonRpcController::SendRawTxCallback> callbacks;
+  for (size_t i = 0; i < 2; ++i) {
+    callbacks.push_back(base::BindLambdaForTesting(
+        [&failures](bool status, const std::string& tx_hash) {
+          if (!status)
+            failures++;
+        }));
+  }
+  controller.SendRawTransactions({"0xf1", "0xf2"}, std::move(callbacks));
+  base::RunLoop().RunUntilIdle();
+
+  EXPECT_EQ(failures, 2);
+}
+
 }  // namespace brave_wallet
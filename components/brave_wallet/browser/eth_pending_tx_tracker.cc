@@ -5,7 +5,9 @@
 
 #include "brave/components/brave_wallet/browser/eth_pending_tx_tracker.h"
 
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "base/logging.h"
 #include "base/synchronization/lock.h"
@@ -31,18 +33,21 @@ void EthPendingTxTracker::UpdatePendingTransactions() {
   auto pending_transactions = tx_state_manager_->GetTransactionsByStatus(
       EthTxStateManager::TransactionStatus::SUBMITTED,
       base::Optional<EthAddress>());
+  std::vector<std::string> tx_hashes;
+  std::vector<EthJsonRpcController::GetTxReceiptCallback> callbacks;
   for (const auto& pending_transaction : pending_transactions) {
     if (IsNonceTaken(pending_transaction)) {
       DropTransaction(pending_transaction);
-      nonce_lock->Release();
-      return;
+      break;
     }
     std::string id = pending_transaction.id;
-    rpc_controller_->GetTransactionReceipt(
-        pending_transaction.tx_hash,
-        base::BindOnce(&EthPendingTxTracker::OnGetTxReceipt,
-                       weak_factory_.GetWeakPtr(), std::move(id)));
+    tx_hashes.push_back(pending_transaction.tx_hash);
+    callbacks.push_back(base::BindOnce(&EthPendingTxTracker::OnGetTxReceipt,
+                                       weak_factory_.GetWeakPtr(),
+                                       std::move(id)));
   }
+  // All receipts are fetched in one JSON-RPC batch.
+  rpc_controller_->GetTransactionReceipts(tx_hashes, std::move(callbacks));
 
   nonce_lock->Release();
 }
@@ -52,15 +57,18 @@ void EthPendingTxTracker::ResubmitPendingTransactions() {
   auto pending_transactions = tx_state_manager_->GetTransactionsByStatus(
       EthTxStateManager::TransactionStatus::SUBMITTED,
       base::Optional<EthAddress>());
+  std::vector<std::string> signed_txs;
+  std::vector<EthJsonRpcController::SendRawTxCallback> callbacks;
   for (const auto& pending_transaction : pending_transactions) {
     if (!pending_transaction.tx.IsSigned()) {
       continue;
     }
-    rpc_controller_->SendRawTransaction(
-        pending_transaction.tx.GetSignedTransaction(),
+    signed_txs.push_back(pending_transaction.tx.GetSignedTransaction());
+    callbacks.push_back(
         base::BindOnce(&EthPendingTxTracker::OnSendRawTransaction,
                        weak_factory_.GetWeakPtr()));
   }
+  rpc_controller_->SendRawTransactions(signed_txs, std::move(callbacks));
 }
 
 void EthPendingTxTracker::OnGetTxReceipt(std::string id,
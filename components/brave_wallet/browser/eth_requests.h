@@ -7,6 +7,8 @@
 #define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_ETH_REQUESTS_H_
 
 #include <string>
+#include <vector>
+
 #include "base/values.h"
 
 namespace brave_wallet {
@@ -184,6 +186,11 @@ std::string eth_getLogs(const std::string& from_block_quantity_tag,
 // condition to be met (“target”).
 std::string eth_getWork();
 
+// Combines requests built by the functions above into one JSON-RPC 2.0 batch.
+// Each request's id is replaced by its index in |requests|. Returns an empty
+// string if any of them is not a JSON object.
+std::string GetJsonRpcBatch(const std::vector<std::string>& requests);
+
 }  // namespace brave_wallet
 
 #endif  // BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_ETH_REQUESTS_H_
@@ -328,4 +328,13 @@ TEST(EthRequestUnitTest, eth_getLogs) {
       R"({"id":1,"jsonrpc":"2.0","method":"eth_getLogs","params":[{"address":"0x8888f1f195afa192cfee860698584c030f4c9db1","blockhash":"0xb903239f8543d04b5dc1ba6579132b143087c68db1b2168786408fcbce568238","fromBlock":"0x1","toBlock":"0x2","topics":["0x000000000000000000000000a94f5374fce5edbc8e2a8697c15331677e6ebf0b",["0x000000000000000000000000a94f5374fce5edbc8e2a8697c15331677e6ebf0b","0x0000000000000000000000000aff3454fce5edbc8cca8697c15331677e6ebccc"]]}]})");  // NOLINT
 }
 
+TEST(EthRequestUnitTest, GetJsonRpcBatch) {
+  ASSERT_EQ(
+      GetJsonRpcBatch({eth_getTransactionReceipt("0x1"),
+                       eth_getTransactionReceipt("0x2")}),
+      R"([{"id":0,"jsonrpc":"2.0","method":"eth_getTransactionReceipt","params":["0x1"]},{"id":1,"jsonrpc":"2.0","method":"eth_getTransactionReceipt","params":["0x2"]}])");  // NOLINT
+  ASSERT_EQ(GetJsonRpcBatch({}), "[]");
+  ASSERT_EQ(GetJsonRpcBatch({eth_blockNumber(), "[]"}), "");
+}
+
 }  // namespace brave_wallet
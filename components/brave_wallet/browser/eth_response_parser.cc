@@ -8,45 +8,40 @@
 #include <utility>
 
 #include "base/json/json_reader.h"
+#include "base/json/json_writer.h"
 #include "base/logging.h"
 #include "base/strings/string_number_conversions.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
 
 namespace {
 
-bool ParseResult(const std::string& json, base::Value* result) {
-  DCHECK(result);
+absl::optional<base::Value> ParseResponse(const std::string& json) {
   base::JSONReader::ValueWithError value_with_error =
       base::JSONReader::ReadAndReturnValueWithError(
           json, base::JSONParserOptions::JSON_PARSE_RFC);
-  absl::optional<base::Value>& records_v = value_with_error.value;
-  if (!records_v) {
+  if (!value_with_error.value) {
     LOG(ERROR) << "Invalid response, could not parse JSON, JSON is: " << json;
-    return false;
-  }
-
-  const base::DictionaryValue* response_dict;
-  if (!records_v->GetAsDictionary(&response_dict)) {
-    return false;
   }
 
-  const base::Value* result_v = response_dict->FindPath("result");
-  if (!result_v)
-    return false;
+  return std::move(value_with_error.value);
+}
 
-  *result = result_v->Clone();
+const base::Value* FindResult(const base::Value& response) {
+  if (!response.is_dict())
+    return nullptr;
 
-  return true;
+  return response.FindKey("result");
 }
 
-bool ParseSingleStringResult(const std::string& json, std::string* result) {
+bool ParseSingleStringResult(const base::Value& response,
+                             std::string* result) {
   DCHECK(result);
 
-  base::Value result_v;
-  if (!ParseResult(json, &result_v))
+  const base::Value* result_v = FindResult(response);
+  if (!result_v)
     return false;
 
-  const std::string* result_str = result_v.GetIfString();
+  const std::string* result_str = result_v->GetIfString();
   if (!result_str)
     return false;
 
@@ -60,12 +55,24 @@ bool ParseSingleStringResult(const std::string& json, std::string* result) {
 namespace brave_wallet {
 
 bool ParseEthGetBalance(const std::string& json, std::string* hex_balance) {
-  return ParseSingleStringResult(json, hex_balance);
+  absl::optional<base::Value> response = ParseResponse(json);
+  return response && ParseEthGetBalance(*response, hex_balance);
+}
+
+bool ParseEthGetBalance(const base::Value& response,
+                        std::string* hex_balance) {
+  return ParseSingleStringResult(response, hex_balance);
 }
 
 bool ParseEthGetTransactionCount(const std::string& json, uint256_t* count) {
+  absl::optional<base::Value> response = ParseResponse(json);
+  return response && ParseEthGetTransactionCount(*response, count);
+}
+
+bool ParseEthGetTransactionCount(const base::Value& response,
+                                 uint256_t* count) {
   std::string count_str;
-  if (!ParseSingleStringResult(json, &count_str))
+  if (!ParseSingleStringResult(response, &count_str))
     return false;
 
   if (!HexValueToUint256(count_str, count))
@@ -76,13 +83,19 @@ bool ParseEthGetTransactionCount(const std::string& json, uint256_t* count) {
 
 bool ParseEthGetTransactionReceipt(const std::string& json,
                                    TransactionReceipt* receipt) {
+  absl::optional<base::Value> response = ParseResponse(json);
+  return response && ParseEthGetTransactionReceipt(*response, receipt);
+}
+
+bool ParseEthGetTransactionReceipt(const base::Value& response,
+                                   TransactionReceipt* receipt) {
   DCHECK(receipt);
 
-  base::Value result;
-  if (!ParseResult(json, &result))
+  const base::Value* result = FindResult(response);
+  if (!result)
     return false;
   const base::DictionaryValue* result_dict = nullptr;
-  if (!result.GetAsDictionary(&result_dict))
+  if (!result->GetAsDictionary(&result_dict))
     return false;
   DCHECK(result_dict);
 
@@ -142,11 +155,67 @@ bool ParseEthGetTransactionReceipt(const std::string& json,
 }
 
 bool ParseEthSendRawTransaction(const std::string& json, std::string* tx_hash) {
-  return ParseSingleStringResult(json, tx_hash);
+  absl::optional<base::Value> response = ParseResponse(json);
+  return response && ParseEthSendRawTransaction(*response, tx_hash);
+}
+
+bool ParseEthSendRawTransaction(const base::Value& response,
+                                std::string* tx_hash) {
+  return ParseSingleStringResult(response, tx_hash);
 }
 
 bool ParseEthCall(const std::string& json, std::string* result) {
-  return ParseSingleStringResult(json, result);
+  absl::optional<base::Value> response = ParseResponse(json);
+  return response && ParseEthCall(*response, result);
+}
+
+bool ParseEthCall(const base::Value& response, std::string* result) {
+  return ParseSingleStringResult(response, result);
+}
+
+bool ParseJsonRpcBatchResponse(const std::string& json,
+                               size_t request_count,
+                               std::vector<std::string>* responses) {
+  DCHECK(responses);
+
+  absl::optional<base::Value> batch = base::JSONReader::Read(
+      json, base::JSONParserOptions::JSON_PARSE_RFC);
+  if (!batch || !batch->is_list())
+    return false;
+
+  responses->assign(request_count, std::string());
+  for (const auto& response : batch->GetList()) {
+    if (!response.is_dict())
+      continue;
+    absl::optional<int> id = response.FindIntKey("id");
+    if (!id || *id < 0 || static_cast<size_t>(*id) >= request_count)
+      continue;
+    base::JSONWriter::Write(response, &(*responses)[*id]);
+  }
+
+  return true;
+}
+
+bool ParseJsonRpcBatchResponse(base::Value batch,
+                               size_t request_count,
+                               std::vector<base::Value>* responses) {
+  DCHECK(responses);
+
+  if (!batch.is_list())
+    return false;
+
+  responses->clear();
+  responses->resize(request_count);
+  for (auto& response : batch.GetList()) {
+    if (!response.is_dict())
+      continue;
+    absl::optional<int> id = response.FindIntKey("id");
+    if (!id || *id < 0 || static_cast<size_t>(*id) >= request_count)
+      continue;
+    (*responses)[*id] = std::move(response);
+  }
+
+  return true;
 }
 
 }  // namespace brave_wallet
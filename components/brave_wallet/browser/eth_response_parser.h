@@ -7,6 +7,8 @@
 #define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_ETH_RESPONSE_PARSER_H_
 
 #include <string>
+#include <vector>
+
 #include "base/values.h"
 
 #include "brave/components/brave_wallet/browser/brave_wallet_types.h"
@@ -20,6 +22,27 @@ bool ParseEthGetTransactionReceipt(const std::string& json,
                                    TransactionReceipt* receipt);
 bool ParseEthSendRawTransaction(const std::string& json, std::string* tx_hash);
 bool ParseEthCall(const std::string& json, std::string* result);
+// Splits the response to a batch built by GetJsonRpcBatch into one response
+// per request, in request order, so each can be handed to the parsers above.
+// Requests the batch has no response for are left empty.
+bool ParseJsonRpcBatchResponse(const std::string& json,
+                               size_t request_count,
+                               std::vector<std::string>* responses);
+
+// Overloads for responses that were already parsed, such as those delivered
+// by APIRequestHelper::RequestJSON.
+bool ParseEthGetBalance(const base::Value& response, std::string* hex_balance);
+bool ParseEthGetTransactionCount(const base::Value& response,
+                                 uint256_t* count);
+bool ParseEthGetTransactionReceipt(const base::Value& response,
+                                   TransactionReceipt* receipt);
+bool ParseEthSendRawTransaction(const base::Value& response,
+                                std::string* tx_hash);
+bool ParseEthCall(const base::Value& response, std::string* result);
+// Requests the batch has no response for are left as NONE values.
+bool ParseJsonRpcBatchResponse(base::Value batch,
+                               size_t request_count,
+                               std::vector<base::Value>* responses);
 
 }  // namespace brave_wallet
 
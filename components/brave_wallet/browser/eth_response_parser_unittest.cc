@@ -7,6 +7,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/json/json_reader.h"
 #include "brave/components/brave_wallet/browser/eth_response_parser.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -126,4 +127,56 @@ TEST(EthResponseParserUnitTest, ParseEthGetTransactionReceiptNullContractAddr) {
   EXPECT_TRUE(receipt.status);
 }
 
+TEST(EthResponseParserUnitTest, ParseJsonRpcBatchResponse) {
+  // Responses may come back in any order, and some may be missing or be
+  // errors.
+  std::string json(R"([
+      {"jsonrpc":"2.0","id":2,"result":"0x2"},
+      {"jsonrpc":"2.0","id":0,"result":"0x0"},
+      {"jsonrpc":"2.0","id":3,"error":{"code":-32000,"message":"failed"}},
+      {"jsonrpc":"2.0","id":7,"result":"0x7"}
+    ])");
+  std::vector<std::string> responses;
+  ASSERT_TRUE(ParseJsonRpcBatchResponse(json, 4, &responses));
+  ASSERT_EQ(responses.size(), 4UL);
+
+  std::string result;
+  EXPECT_TRUE(ParseEthCall(responses[0], &result));
+  EXPECT_EQ(result, "0x0");
+  EXPECT_FALSE(ParseEthCall(responses[1], &result));
+  EXPECT_TRUE(ParseEthCall(responses[2], &result));
+  EXPECT_EQ(result, "0x2");
+  EXPECT_FALSE(ParseEthCall(responses[3], &result));
+
+  // A single error object is not a batch response.
+  EXPECT_FALSE(ParseJsonRpcBatchResponse(
+      R"({"jsonrpc":"2.0","id":null,"error":{"code":-32600}})", 2,
+      &responses));
+  EXPECT_FALSE(ParseJsonRpcBatchResponse("invalid", 2, &responses));
+}
+
+TEST(EthResponseParserUnitTest, ParseJsonRpcBatchResponseValue) {
+  absl::optional<base::Value> batch = base::JSONReader::Read(R"([
+      {"jsonrpc":"2.0","id":1,"result":{"transactionHash":"0x1"}},
+      {"jsonrpc":"2.0","id":0,"result":"0x0"},
+      {"jsonrpc":"2.0","id":5,"result":"0x5"}
+    ])");
+  ASSERT_TRUE(batch);
+  std::vector<base::Value> responses;
+  ASSERT_TRUE(ParseJsonRpcBatchResponse(std::move(*batch), 3, &responses));
+  ASSERT_EQ(responses.size(), 3UL);
+
+  std::string result;
+  EXPECT_TRUE(ParseEthCall(responses[0], &result));
+  EXPECT_EQ(result, "0x0");
+  // The result is not a string, and the receipt is missing fields.
+  EXPECT_FALSE(ParseEthCall(responses[1], &result));
+  TransactionReceipt receipt;
+  EXPECT_FALSE(ParseEthGetTransactionReceipt(responses[1], &receipt));
+  EXPECT_TRUE(responses[2].is_none());
+  EXPECT_FALSE(ParseEthCall(responses[2], &result));
+
+  EXPECT_FALSE(ParseJsonRpcBatchResponse(base::Value(), 2, &responses));
+}
+
 }  // namespace brave_wallet
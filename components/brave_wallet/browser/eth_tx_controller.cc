@@ -14,14 +14,17 @@
 #include "brave/components/brave_wallet/browser/eth_json_rpc_controller.h"
 #include "brave/components/brave_wallet/browser/hd_keyring.h"
 #include "brave/components/brave_wallet/browser/keyring_controller.h"
+#include "components/prefs/persistent_pref_store.h"
 
 namespace brave_wallet {
 
 EthTxController::EthTxController(
     base::WeakPtr<BraveWalletService> wallet_service,
-    PrefService* prefs)
+    PrefService* prefs,
+    scoped_refptr<PersistentPrefStore> tx_store)
     : wallet_service_(wallet_service),
-      tx_state_manager_(std::make_unique<EthTxStateManager>(prefs)),
+      tx_state_manager_(
+          std::make_unique<EthTxStateManager>(prefs, std::move(tx_store))),
       nonce_tracker_(
           std::make_unique<EthNonceTracker>(tx_state_manager_.get(),
                                             wallet_service_->rpc_controller())),
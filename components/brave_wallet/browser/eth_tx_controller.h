@@ -16,6 +16,7 @@
 #include "brave/components/brave_wallet/browser/eth_transaction.h"
 #include "brave/components/brave_wallet/browser/eth_tx_state_manager.h"
 
+class PersistentPrefStore;
 class PrefService;
 
 namespace base {
@@ -35,8 +36,9 @@ class EthTxController {
    protected:
     ~Observer() override = default;
   };
-  explicit EthTxController(base::WeakPtr<BraveWalletService> wallet_service,
-                           PrefService* prefs);
+  EthTxController(base::WeakPtr<BraveWalletService> wallet_service,
+                  PrefService* prefs,
+                  scoped_refptr<PersistentPrefStore> tx_store);
   ~EthTxController();
   EthTxController(const EthTxController&) = delete;
   EthTxController operator=(const EthTxController&) = delete;
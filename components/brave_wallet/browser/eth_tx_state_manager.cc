@@ -5,6 +5,9 @@
 
 #include "brave/components/brave_wallet/browser/eth_tx_state_manager.h"
 
+#include <memory>
+#include <utility>
+
 #include "base/guid.h"
 #include "base/logging.h"
 #include "base/util/values/values_util.h"
@@ -12,26 +15,25 @@
 #include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
 #include "brave/components/brave_wallet/browser/eth_address.h"
 #include "brave/components/brave_wallet/browser/pref_names.h"
+#include "components/prefs/persistent_pref_store.h"
 #include "components/prefs/pref_service.h"
-#include "components/prefs/scoped_user_pref_update.h"
 
 namespace brave_wallet {
 
-EthTxStateManager::EthTxStateManager(PrefService* prefs) : prefs_(prefs) {
-  const base::DictionaryValue* value =
-      prefs_->GetDictionary(kBraveWalletTransactions);
-  for (base::DictionaryValue::Iterator iter(*value); !iter.IsAtEnd();
-       iter.Advance()) {
-    const std::string id = iter.key();
-    base::Optional<TxMeta> meta = ValueToTxMeta(iter.value());
-    if (!meta) {
-      LOG(ERROR) << "invalid TxMeta, id=" << id;
-      continue;
-    }
-    tx_meta_map_[id] = *meta;
+EthTxStateManager::EthTxStateManager(PrefService* prefs,
+                                     scoped_refptr<PersistentPrefStore> store)
+    : prefs_(prefs), store_(std::move(store)) {
+  if (store_->IsInitializationComplete()) {
+    OnInitializationCompleted(true);
+    return;
   }
+  store_->AddObserver(this);
+  store_->ReadPrefsAsync(nullptr);
+}
+
+EthTxStateManager::~EthTxStateManager() {
+  store_->RemoveObserver(this);
 }
-EthTxStateManager::~EthTxStateManager() = default;
 
 EthTxStateManager::TxMeta::TxMeta() = default;
 EthTxStateManager::TxMeta::TxMeta(const EthTransaction& tx) : tx(tx) {}
@@ -129,10 +131,10 @@ base::Optional<EthTxStateManager::TxMeta> EthTxStateManager::ValueToTxMeta(
 }
 
 void EthTxStateManager::AddOrUpdateTx(const TxMeta& meta) {
-  DictionaryPrefUpdate update(prefs_, kBraveWalletTransactions);
-  base::DictionaryValue* dict = update.Get();
-  dict->SetKey(meta.id, TxMetaToValue(meta));
+  RemoveFromIndices(meta.id);
+  AddToIndices(meta);
   tx_meta_map_[meta.id] = meta;
+  SaveTx(meta.id);
 }
 
 bool EthTxStateManager::GetTx(const std::string& id, TxMeta* meta) {
@@ -148,29 +150,148 @@ bool EthTxStateManager::GetTx(const std::string& id, TxMeta* meta) {
 }
 
 void EthTxStateManager::DeleteTx(const std::string& id) {
-  DictionaryPrefUpdate update(prefs_, kBraveWalletTransactions);
-  base::DictionaryValue* dict = update.Get();
-  dict->RemoveKey(id);
+  RemoveFromIndices(id);
   tx_meta_map_.erase(id);
+  SaveTx(id);
 }
 
 void EthTxStateManager::WipeTxs() {
-  prefs_->ClearPref(kBraveWalletTransactions);
   tx_meta_map_.clear();
+  status_index_.clear();
+  from_index_.clear();
+  unsaved_ids_.clear();
+  prefs_->ClearPref(kBraveWalletTransactions);
+  if (!store_loaded_) {
+    wipe_on_load_ = true;
+    return;
+  }
+  RemoveStoredTxs();
 }
 
 std::vector<EthTxStateManager::TxMeta>
 EthTxStateManager::GetTransactionsByStatus(TransactionStatus status,
                                            base::Optional<EthAddress> from) {
   std::vector<EthTxStateManager::TxMeta> result;
-  for (auto& tx_meta : tx_meta_map_) {
-    if (tx_meta.second.status == status) {
-      if (from.has_value() && tx_meta.second.from != *from)
-        continue;
-      result.push_back(tx_meta.second);
-    }
+  auto status_iter = status_index_.find(status);
+  if (status_iter == status_index_.end())
+    return result;
+
+  // Walk whichever of the status and address buckets is smaller.
+  const std::set<std::string>* ids = &status_iter->second;
+  if (from.has_value()) {
+    auto from_iter = from_index_.find(from->ToHex());
+    if (from_iter == from_index_.end())
+      return result;
+    if (from_iter->second.size() < ids->size())
+      ids = &from_iter->second;
+  }
+
+  for (const std::string& id : *ids) {
+    auto iter = tx_meta_map_.find(id);
+    DCHECK(iter != tx_meta_map_.end());
+    if (iter->second.status != status)
+      continue;
+    if (from.has_value() && iter->second.from != *from)
+      continue;
+    result.push_back(iter->second);
   }
   return result;
 }
 
+void EthTxStateManager::OnInitializationCompleted(bool succeeded) {
+  store_->RemoveObserver(this);
+  store_loaded_ = true;
+  if (!succeeded)
+    LOG(ERROR) << "Failed to load wallet transactions";
+
+  if (wipe_on_load_) {
+    // Txs added since the wipe are written back below.
+    wipe_on_load_ = false;
+    RemoveStoredTxs();
+  } else {
+    std::unique_ptr<base::DictionaryValue> values = store_->GetValues();
+    LoadTxs(*values, false);
+    // Move txs stored in the profile prefs by earlier versions.
+    const base::DictionaryValue* legacy_values =
+        prefs_->GetDictionary(kBraveWalletTransactions);
+    if (!legacy_values->DictEmpty()) {
+      LoadTxs(*legacy_values, true);
+      prefs_->ClearPref(kBraveWalletTransactions);
+    }
+  }
+
+  std::set<std::string> unsaved_ids = std::move(unsaved_ids_);
+  for (const std::string& id : unsaved_ids)
+    SaveTx(id);
+}
+
+void EthTxStateManager::LoadTxs(const base::DictionaryValue& values,
+                                bool save) {
+  for (base::DictionaryValue::Iterator iter(values); !iter.IsAtEnd();
+       iter.Advance()) {
+    const std::string id = iter.key();
+    if (unsaved_ids_.count(id) || tx_meta_map_.count(id))
+      continue;
+    base::Optional<TxMeta> meta = ValueToTxMeta(iter.value());
+    if (!meta) {
+      LOG(ERROR) << "invalid TxMeta, id=" << id;
+      continue;
+    }
+    meta->id = id;
+    AddToIndices(*meta);
+    tx_meta_map_.emplace(id, std::move(*meta));
+    if (save)
+      SaveTx(id);
+  }
+}
+
+void EthTxStateManager::RemoveStoredTxs() {
+  std::unique_ptr<base::DictionaryValue> values = store_->GetValues();
+  for (base::DictionaryValue::Iterator iter(*values); !iter.IsAtEnd();
+       iter.Advance()) {
+    store_->RemoveValue(iter.key(),
+                        WriteablePrefStore::DEFAULT_PREF_WRITE_FLAGS);
+  }
+}
+
+void EthTxStateManager::SaveTx(const std::string& id) {
+  if (!store_loaded_) {
+    unsaved_ids_.insert(id);
+    return;
+  }
+  auto iter = tx_meta_map_.find(id);
+  if (iter == tx_meta_map_.end()) {
+    store_->RemoveValue(id, WriteablePrefStore::DEFAULT_PREF_WRITE_FLAGS);
+    return;
+  }
+  store_->SetValue(id,
+                   std::make_unique<base::Value>(TxMetaToValue(iter->second)),
+                   WriteablePrefStore::DEFAULT_PREF_WRITE_FLAGS);
+}
+
+void EthTxStateManager::AddToIndices(const TxMeta& meta) {
+  status_index_[meta.status].insert(meta.id);
+  from_index_[meta.from.ToHex()].insert(meta.id);
+}
+
+void EthTxStateManager::RemoveFromIndices(const std::string& id) {
+  auto iter = tx_meta_map_.find(id);
+  if (iter == tx_meta_map_.end())
+    return;
+
+  auto status_iter = status_index_.find(iter->second.status);
+  if (status_iter != status_index_.end()) {
+    status_iter->second.erase(id);
+    if (status_iter->second.empty())
+      status_index_.erase(status_iter);
+  }
+
+  auto from_iter = from_index_.find(iter->second.from.ToHex());
+  if (from_iter != from_index_.end()) {
+    from_iter->second.erase(id);
+    if (from_iter->second.empty())
+      from_index_.erase(from_iter);
+  }
+}
+
 }  // namespace brave_wallet
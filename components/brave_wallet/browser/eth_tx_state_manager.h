@@ -6,25 +6,35 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_ETH_TX_STATE_MANAGER_H_
 #define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_ETH_TX_STATE_MANAGER_H_
 
+#include <map>
+#include <set>
 #include <string>
 #include <vector>
 
-#include "base/containers/flat_map.h"
+#include "base/memory/scoped_refptr.h"
 #include "base/optional.h"
 #include "base/time/time.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_types.h"
 #include "brave/components/brave_wallet/browser/eth_address.h"
 #include "brave/components/brave_wallet/browser/eth_transaction.h"
+#include "components/prefs/pref_store.h"
 
+class PersistentPrefStore;
 class PrefService;
 
 namespace base {
+class DictionaryValue;
 class Value;
 }  // namespace base
 
 namespace brave_wallet {
 
-class EthTxStateManager {
+// Keeps the wallet's transactions in memory and persists them to |store|, a
+// JSON file of their own, so the transaction history is not rewritten with
+// every write of the profile preferences. Writes to |store| are still not
+// per record: JsonPrefStore serializes the whole file again on each (batched)
+// commit, so saving one transaction costs O(history).
+class EthTxStateManager : public PrefStore::Observer {
  public:
   enum class TransactionStatus {
     UNAPPROVED,
@@ -54,13 +64,16 @@ class EthTxStateManager {
     EthTransaction tx;
   };
 
-  explicit EthTxStateManager(PrefService* prefs);
-  ~EthTxStateManager();
+  // |prefs| is only read to move transactions stored in the profile
+  // preferences by earlier versions into |store|.
+  EthTxStateManager(PrefService* prefs,
+                    scoped_refptr<PersistentPrefStore> store);
+  ~EthTxStateManager() override;
   EthTxStateManager(const EthTxStateManager&) = delete;
   EthTxStateManager operator=(const EthTxStateManager&) = delete;
 
   static std::string GenerateMetaID();
-  // id will be excluded because it is used as key of dictionary
+  // id will be excluded because it is used as key in the store
   static base::Value TxMetaToValue(const TxMeta& meta);
   static base::Optional<TxMeta> ValueToTxMeta(const base::Value& value);
 
@@ -73,8 +86,36 @@ class EthTxStateManager {
                                               base::Optional<EthAddress> from);
 
  private:
+  // PrefStore::Observer:
+  void OnPrefValueChanged(const std::string& key) override {}
+  void OnInitializationCompleted(bool succeeded) override;
+
+  // Adds the txs in |values| that were not changed since the store started
+  // loading. When |save| is set they are also written to the store.
+  void LoadTxs(const base::DictionaryValue& values, bool save);
+  void RemoveStoredTxs();
+  // Writes the current state of tx |id| to the store, or defers it until the
+  // store has finished loading.
+  void SaveTx(const std::string& id);
+  void AddToIndices(const TxMeta& meta);
+  void RemoveFromIndices(const std::string& id);
+
   PrefService* prefs_;
-  base::flat_map<std::string, TxMeta> tx_meta_map_;
+  scoped_refptr<PersistentPrefStore> store_;
+  bool store_loaded_ = false;
+  // Ids of the txs added, updated or deleted before the store loaded. Their
+  // in-memory state wins over the stored one.
+  std::set<std::string> unsaved_ids_;
+  // Set when WipeTxs() is called before the store loaded.
+  bool wipe_on_load_ = false;
+  // std::map rather than base::flat_map so that inserting a new tx does not
+  // shift every stored TxMeta once the history grows large.
+  std::map<std::string, TxMeta> tx_meta_map_;
+  // Ids of the txs in each status, kept in sync with |tx_meta_map_| so
+  // lookups by status only visit matching txs instead of the whole history.
+  std::map<TransactionStatus, std::set<std::string>> status_index_;
+  // Ids of the txs sent from each address, keyed by EthAddress::ToHex().
+  std::map<std::string, std::set<std::string>> from_index_;
 };
 
 }  // namespace brave_wallet
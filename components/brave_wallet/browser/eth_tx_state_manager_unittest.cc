@@ -5,9 +5,15 @@
 
 #include "brave/components/brave_wallet/browser/eth_tx_state_manager.h"
 
+#include "base/memory/scoped_refptr.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/time/time.h"
 #include "base/values.h"
 #include "brave/components/brave_wallet/browser/eth_address.h"
+#include "brave/components/brave_wallet/browser/pref_names.h"
+#include "components/prefs/scoped_user_pref_update.h"
+#include "components/prefs/testing_pref_service.h"
+#include "components/prefs/testing_pref_store.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
 namespace brave_wallet {
@@ -61,4 +67,111 @@ TEST(EthTxStateManagerUnitTest, TxMetaAndValye) {
   EXPECT_EQ(meta_from_value->tx, meta.tx);
 }
 
+TEST(EthTxStateManagerUnitTest, GetTransactionsByStatus) {
+  TestingPrefServiceSimple prefs;
+  prefs.registry()->RegisterDictionaryPref(kBraveWalletTransactions);
+  auto store = base::MakeRefCounted<TestingPrefStore>();
+  EthTxStateManager tx_state_manager(&prefs, store);
+
+  const EthAddress addr1 =
+      EthAddress::FromHex("0x3535353535353535353535353535353535353535");
+  const EthAddress addr2 =
+      EthAddress::FromHex("0x2f015c60e0be116b1f0cd534704db9c92118fb6a");
+
+  for (size_t i = 0; i < 4; ++i) {
+    EthTxStateManager::TxMeta meta;
+    meta.id = base::NumberToString(i);
+    meta.from = i % 2 ? addr2 : addr1;
+    meta.status = i < 2 ? EthTxStateManager::TransactionStatus::SUBMITTED
+                        : EthTxStateManager::TransactionStatus::CONFIRMED;
+    tx_state_manager.AddOrUpdateTx(meta);
+  }
+
+  EXPECT_EQ(tx_state_manager
+                .GetTransactionsByStatus(
+                    EthTxStateManager::TransactionStatus::SUBMITTED,
+                    base::nullopt)
+                .size(),
+            2u);
+  auto confirmed = tx_state_manager.GetTransactionsByStatus(
+      EthTxStateManager::TransactionStatus::CONFIRMED, addr1);
+  ASSERT_EQ(confirmed.size(), 1u);
+  EXPECT_EQ(confirmed[0].id, "2");
+  EXPECT_TRUE(tx_state_manager
+                  .GetTransactionsByStatus(
+                      EthTxStateManager::TransactionStatus::FAILED,
+                      base::nullopt)
+                  .empty());
+
+  // Status changes move the tx between buckets.
+  EthTxStateManager::TxMeta meta;
+  ASSERT_TRUE(tx_state_manager.GetTx("0", &meta));
+  meta.status = EthTxStateManager::TransactionStatus::CONFIRMED;
+  tx_state_manager.AddOrUpdateTx(meta);
+  EXPECT_EQ(tx_state_manager
+                .GetTransactionsByStatus(
+                    EthTxStateManager::TransactionStatus::SUBMITTED,
+                    base::nullopt)
+                .size(),
+            1u);
+  EXPECT_EQ(tx_state_manager
+                .GetTransactionsByStatus(
+                    EthTxStateManager::TransactionStatus::CONFIRMED, addr1)
+                .size(),
+            2u);
+
+  tx_state_manager.DeleteTx("1");
+  EXPECT_TRUE(tx_state_manager
+                  .GetTransactionsByStatus(
+                      EthTxStateManager::TransactionStatus::SUBMITTED,
+                      base::nullopt)
+                  .empty());
+
+  // A manager loaded from the store rebuilds the indices and keeps the ids.
+  EthTxStateManager reloaded(&prefs, store);
+  confirmed = reloaded.GetTransactionsByStatus(
+      EthTxStateManager::TransactionStatus::CONFIRMED, addr1);
+  ASSERT_EQ(confirmed.size(), 2u);
+  EXPECT_EQ(confirmed[0].id, "0");
+  EXPECT_EQ(confirmed[1].id, "2");
+
+  reloaded.WipeTxs();
+  EXPECT_TRUE(reloaded
+                  .GetTransactionsByStatus(
+                      EthTxStateManager::TransactionStatus::CONFIRMED,
+                      base::nullopt)
+                  .empty());
+}
+
+TEST(EthTxStateManagerUnitTest, MigratesTxsFromProfilePrefs) {
+  TestingPrefServiceSimple prefs;
+  prefs.registry()->RegisterDictionaryPref(kBraveWalletTransactions);
+  EthTxStateManager::TxMeta meta;
+  meta.from = EthAddress::FromHex("0x3535353535353535353535353535353535353535");
+  meta.status = EthTxStateManager::TransactionStatus::SUBMITTED;
+  {
+    DictionaryPrefUpdate update(&prefs, kBraveWalletTransactions);
+    update->SetKey("legacy", EthTxStateManager::TxMetaToValue(meta));
+  }
+
+  // Txs added while the store is loading are kept.
+  auto store = base::MakeRefCounted<TestingPrefStore>();
+  store->SetBlockAsyncRead(true);
+  EthTxStateManager tx_state_manager(&prefs, store);
+  meta.id = "new";
+  tx_state_manager.AddOrUpdateTx(meta);
+  store->SetBlockAsyncRead(false);
+
+  EXPECT_FALSE(prefs.HasPrefPath(kBraveWalletTransactions));
+  EXPECT_EQ(tx_state_manager
+                .GetTransactionsByStatus(
+                    EthTxStateManager::TransactionStatus::SUBMITTED,
+                    meta.from)
+                .size(),
+            2u);
+  const base::Value* value = nullptr;
+  EXPECT_TRUE(store->GetValue("legacy", &value));
+  EXPECT_TRUE(store->GetValue("new", &value));
+}
+
 }  // namespace brave_wallet
@@ -5,6 +5,9 @@
 
 #include "brave/components/brave_wallet/browser/hd_keyring.h"
 
+#include <utility>
+
+#include "base/check_op.h"
 #include "base/strings/string_number_conversions.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
 #include "brave/components/brave_wallet/browser/eth_address.h"
@@ -27,6 +30,7 @@ void HDKeyring::ClearData() {
   root_.reset();
   master_key_.reset();
   accounts_.clear();
+  address_to_index_.clear();
 }
 
 void HDKeyring::ConstructRootHDKey(const std::vector<uint8_t>& seed,
@@ -43,7 +47,9 @@ void HDKeyring::AddAccounts(size_t number) {
   size_t cur_accounts_number = accounts_.size();
   for (size_t i = cur_accounts_number; i < cur_accounts_number + number; ++i) {
     if (root_) {
-      accounts_.push_back(root_->DeriveChild(i));
+      std::unique_ptr<HDKey> account = root_->DeriveChild(i);
+      if (account)
+        AppendAccount(std::move(account));
     }
   }
 }
@@ -57,10 +63,16 @@ std::vector<std::string> HDKeyring::GetAccounts() {
 }
 
 void HDKeyring::RemoveAccount(const std::string& address) {
-  for (size_t i = 0; i < accounts_.size(); ++i) {
-    if (GetAddress(i) == address) {
-      accounts_.erase(accounts_.begin() + i);
-    }
+  auto iter = address_to_index_.find(address);
+  if (iter == address_to_index_.end())
+    return;
+
+  const size_t removed_index = iter->second;
+  accounts_.erase(accounts_.begin() + removed_index);
+  address_to_index_.erase(iter);
+  for (auto& entry : address_to_index_) {
+    if (entry.second > removed_index)
+      --entry.second;
   }
 }
 
@@ -109,11 +121,18 @@ std::vector<uint8_t> HDKeyring::SignMessage(
 }
 
 HDKey* HDKeyring::GetHDKeyFromAddress(const std::string& address) {
-  for (size_t i = 0; i < accounts_.size(); ++i) {
-    if (GetAddress(i) == address)
-      return accounts_[i].get();
-  }
-  return nullptr;
+  auto iter = address_to_index_.find(address);
+  if (iter == address_to_index_.end())
+    return nullptr;
+  DCHECK_LT(iter->second, accounts_.size());
+  return accounts_[iter->second].get();
+}
+
+void HDKeyring::AppendAccount(std::unique_ptr<HDKey> account) {
+  DCHECK(account);
+  accounts_.push_back(std::move(account));
+  const size_t index = accounts_.size() - 1;
+  address_to_index_[GetAddress(index)] = index;
 }
 
 }  // namespace brave_wallet
@@ -10,6 +10,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "base/gtest_prod_util.h"
@@ -20,6 +21,7 @@ class EthTransaction;
 
 FORWARD_DECLARE_TEST(HDKeyringUnitTest, ConstructRootHDKey);
 FORWARD_DECLARE_TEST(HDKeyringUnitTest, SignMessage);
+FORWARD_DECLARE_TEST(HDKeyringUnitTest, AddressIndex);
 class HDKeyring {
  public:
   enum Type { kDefault = 0, kLedger, kTrezor, kBitcoin };
@@ -50,7 +52,12 @@ class HDKeyring {
 
  protected:
   HDKey* GetHDKeyFromAddress(const std::string& address);
+  // Appends |account| to |accounts_| and records its address in
+  // |address_to_index_|.
+  void AppendAccount(std::unique_ptr<HDKey> account);
 
+  // Already derived down to |hd_path|, so each account is a single
+  // DeriveChild step from here.
   std::unique_ptr<HDKey> root_;
   std::unique_ptr<HDKey> master_key_;
   std::vector<std::unique_ptr<HDKey>> accounts_;
@@ -58,6 +65,11 @@ class HDKeyring {
  private:
   FRIEND_TEST_ALL_PREFIXES(HDKeyringUnitTest, ConstructRootHDKey);
   FRIEND_TEST_ALL_PREFIXES(HDKeyringUnitTest, SignMessage);
+  FRIEND_TEST_ALL_PREFIXES(HDKeyringUnitTest, AddressIndex);
+
+  // Address of each account to its index in |accounts_|, so signing and
+  // removal don't have to recompute every account's address.
+  std::unordered_map<std::string, size_t> address_to_index_;
 
   HDKeyring(const HDKeyring&) = delete;
   HDKeyring& operator=(const HDKeyring&) = delete;
@@ -104,7 +104,7 @@ TEST(HDKeyringUnitTest, SignMessage) {
   key->SetPrivateKey(private_key);
 
   HDKeyring keyring;
-  keyring.accounts_.push_back(std::move(key));
+  keyring.AppendAccount(std::move(key));
   EXPECT_EQ(keyring.GetAddress(0),
             "0xbE93f9BacBcFFC8ee6663f2647917ed7A20a57BB");
 
@@ -121,6 +121,34 @@ TEST(HDKeyringUnitTest, SignMessage) {
           .empty());
 }
 
+TEST(HDKeyringUnitTest, AddressIndex) {
+  HDKeyring keyring;
+  std::vector<uint8_t> seed;
+  EXPECT_TRUE(base::HexStringToBytes(
+      "13ca6c28d26812f82db27908de0b0b7b18940cc4e9d96ebd7de190f706741489907ef65b"
+      "8f9e36c31dc46e81472b6a5e40a4487e725ace445b8203f243fb8958",
+      &seed));
+  keyring.ConstructRootHDKey(seed, "m/44'/60'/0'/0");
+  keyring.AddAccounts(3);
+  EXPECT_EQ(keyring.address_to_index_.size(), 3u);
+
+  // Removing an account shifts the indices of the ones after it.
+  keyring.RemoveAccount("0x2166fB4e11D44100112B1124ac593081519cA1ec");
+  EXPECT_EQ(keyring.address_to_index_.size(), 2u);
+  EXPECT_EQ(keyring.GetHDKeyFromAddress(
+                "0x02e77f0e2fa06F95BDEa79Fad158477723145838"),
+            keyring.accounts_[1].get());
+  EXPECT_EQ(keyring.GetHDKeyFromAddress(
+                "0x2A22ad45446E8b34Da4da1f4ADd7B1571Ab4e4E7"),
+            keyring.accounts_[0].get());
+  EXPECT_EQ(keyring.GetHDKeyFromAddress(
+                "0x2166fB4e11D44100112B1124ac593081519cA1ec"),
+            nullptr);
+
+  keyring.ClearData();
+  EXPECT_TRUE(keyring.address_to_index_.empty());
+}
+
 TEST(HDKeyringUnitTest, ClearData) {
   HDKeyring keyring;
   std::vector<uint8_t> seed;
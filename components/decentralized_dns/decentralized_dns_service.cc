@@ -45,6 +45,7 @@ void DecentralizedDnsService::RegisterLocalStatePrefs(
 }
 
 void DecentralizedDnsService::OnPreferenceChanged() {
+  resolution_cache_.Clear();
   delegate_->UpdateNetworkService();
 }
 
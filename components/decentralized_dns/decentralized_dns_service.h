@@ -8,6 +8,7 @@
 
 #include <memory>
 
+#include "brave/components/decentralized_dns/resolution_cache.h"
 #include "components/keyed_service/core/keyed_service.h"
 
 namespace content {
@@ -35,11 +36,14 @@ class DecentralizedDnsService : public KeyedService {
 
   static void RegisterLocalStatePrefs(PrefRegistrySimple* registry);
 
+  ResolutionCache* resolution_cache() { return &resolution_cache_; }
+
  private:
   void OnPreferenceChanged();
 
   std::unique_ptr<PrefChangeRegistrar> pref_change_registrar_;
   std::unique_ptr<DecentralizedDnsServiceDelegate> delegate_;
+  ResolutionCache resolution_cache_;
 };
 
 }  // namespace decentralized_dns
@@ -0,0 +1,94 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/decentralized_dns/resolution_cache.h"
+
+#include <utility>
+
+#include "base/bind.h"
+#include "base/threading/sequenced_task_runner_handle.h"
+
+namespace decentralized_dns {
+
+namespace {
+
+const size_t kMaxEntries = 100;
+
+}  // namespace
+
+constexpr base::TimeDelta ResolutionCache::kPositiveTTL;
+constexpr base::TimeDelta ResolutionCache::kNegativeTTL;
+
+ResolutionCache::ResolutionCache() : entries_(kMaxEntries) {}
+
+ResolutionCache::~ResolutionCache() = default;
+
+bool ResolutionCache::Lookup(const std::string& key,
+                             bool* success,
+                             std::string* result) {
+  DCHECK(success);
+  DCHECK(result);
+
+  auto it = entries_.Get(key);
+  if (it == entries_.end())
+    return false;
+
+  if (it->second.expiration <= base::TimeTicks::Now()) {
+    entries_.Erase(it);
+    return false;
+  }
+
+  *success = it->second.success;
+  *result = it->second.result;
+  return true;
+}
+
+void ResolutionCache::Resolve(const std::string& key,
+                              StartRequestCallback start_request,
+                              ResolveCallback callback) {
+  auto& callbacks = pending_callbacks_[{generation_, key}];
+  callbacks.push_back(std::move(callback));
+  if (callbacks.size() > 1)
+    return;
+
+  auto on_resolved =
+      base::BindOnce(&ResolutionCache::OnResolved,
+                     weak_ptr_factory_.GetWeakPtr(), key, generation_);
+  if (!std::move(start_request).Run(std::move(on_resolved))) {
+    // The request could not be built, so answer on a later task as a request
+    // would have.
+    base::SequencedTaskRunnerHandle::Get()->PostTask(
+        FROM_HERE,
+        base::BindOnce(&ResolutionCache::OnResolved,
+                       weak_ptr_factory_.GetWeakPtr(), key, generation_,
+                       false, std::string()));
+  }
+}
+
+void ResolutionCache::Clear() {
+  entries_.Clear();
+  generation_++;
+}
+
+void ResolutionCache::OnResolved(const std::string& key,
+                                 uint64_t generation,
+                                 bool success,
+                                 const std::string& result) {
+  if (generation == generation_) {
+    entries_.Put(key, {success, result,
+                       base::TimeTicks::Now() +
+                           (success ? kPositiveTTL : kNegativeTTL)});
+  }
+
+  auto it = pending_callbacks_.find({generation, key});
+  if (it == pending_callbacks_.end())
+    return;
+  std::vector<ResolveCallback> callbacks = std::move(it->second);
+  pending_callbacks_.erase(it);
+  for (auto& callback : callbacks)
+    std::move(callback).Run(success, result);
+}
+
+}  // namespace decentralized_dns
@@ -0,0 +1,83 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_DECENTRALIZED_DNS_RESOLUTION_CACHE_H_
+#define BRAVE_COMPONENTS_DECENTRALIZED_DNS_RESOLUTION_CACHE_H_
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/callback.h"
+#include "base/containers/mru_cache.h"
+#include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
+
+namespace decentralized_dns {
+
+// Caches the raw eth_call results of ENS and Unstoppable Domains lookups so
+// that subresources and reloads of the same name do not each issue an RPC.
+// Successful results are kept for kPositiveTTL and failures for the shorter
+// kNegativeTTL. Concurrent lookups of the same key share one request.
+class ResolutionCache {
+ public:
+  using ResolveCallback =
+      base::OnceCallback<void(bool success, const std::string& result)>;
+  // Starts the request and returns true if it was issued, in which case
+  // the callback passed to it must eventually be run.
+  using StartRequestCallback = base::OnceCallback<bool(ResolveCallback)>;
+
+  static constexpr base::TimeDelta kPositiveTTL =
+      base::TimeDelta::FromMinutes(5);
+  static constexpr base::TimeDelta kNegativeTTL =
+      base::TimeDelta::FromMinutes(1);
+
+  ResolutionCache();
+  ~ResolutionCache();
+
+  ResolutionCache(const ResolutionCache&) = delete;
+  ResolutionCache& operator=(const ResolutionCache&) = delete;
+
+  // Returns true and fills |success| and |result| if an unexpired entry for
+  // |key| exists.
+  bool Lookup(const std::string& key, bool* success, std::string* result);
+
+  // Runs |callback| asynchronously with the result for |key|. Only the first
+  // caller while a request for |key| is in flight has |start_request| run.
+  void Resolve(const std::string& key,
+               StartRequestCallback start_request,
+               ResolveCallback callback);
+
+  // Drops all cached entries. Requests in flight still answer the callers
+  // waiting on them but are not cached, and later callers for the same key
+  // issue a new request instead of joining them.
+  void Clear();
+
+ private:
+  struct Entry {
+    bool success;
+    std::string result;
+    base::TimeTicks expiration;
+  };
+
+  void OnResolved(const std::string& key,
+                  uint64_t generation,
+                  bool success,
+                  const std::string& result);
+
+  base::MRUCache<std::string, Entry> entries_;
+  // Callers waiting on a request, by the generation it was issued in and
+  // its key.
+  std::map<std::pair<uint64_t, std::string>, std::vector<ResolveCallback>>
+      pending_callbacks_;
+  uint64_t generation_ = 0;
+
+  base::WeakPtrFactory<ResolutionCache> weak_ptr_factory_{this};
+};
+
+}  // namespace decentralized_dns
+
+#endif  // BRAVE_COMPONENTS_DECENTRALIZED_DNS_RESOLUTION_CACHE_H_
@@ -0,0 +1,24 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_GREASELION_BROWSER_FEATURES_H_
+#define BRAVE_COMPONENTS_GREASELION_BROWSER_FEATURES_H_
+
+#include "base/feature_list.h"
+
+namespace greaselion {
+namespace features {
+
+// Installs the extension for a Greaselion rule only once the user navigates
+// to a site the rule applies to, instead of for every rule on startup. The
+// rules a profile has needed are remembered across restarts, but the first
+// visit to a site may load before its extension is ready and run without
+// injection.
+extern const base::Feature kGreaselionLazyInstall;
+
+}  // namespace features
+}  // namespace greaselion
+
+#endif  // BRAVE_COMPONENTS_GREASELION_BROWSER_FEATURES_H_
@@ -11,11 +11,13 @@
 #include "base/base_paths.h"
 #include "base/bind.h"
 #include "base/command_line.h"
+#include "base/containers/flat_set.h"
 #include "base/files/file_path_watcher.h"
 #include "base/files/file_util.h"
 #include "base/json/json_reader.h"
 #include "base/logging.h"
 #include "base/macros.h"
+#include "base/strings/string_piece.h"
 #include "base/strings/stringprintf.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/task/post_task.h"
@@ -96,18 +98,25 @@ void GreaselionRule::Parse(base::DictionaryValue* preconditions_value,
       GreaselionPreconditionValue condition = ParsePrecondition(kv.second);
       if (kv.first == kRewards) {
         preconditions_.rewards_enabled = condition;
+        AddPreconditionBit(REWARDS, condition);
       } else if (kv.first == kTwitterTips) {
         preconditions_.twitter_tips_enabled = condition;
+        AddPreconditionBit(TWITTER_TIPS, condition);
       } else if (kv.first == kRedditTips) {
         preconditions_.reddit_tips_enabled = condition;
+        AddPreconditionBit(REDDIT_TIPS, condition);
       } else if (kv.first == kGithubTips) {
         preconditions_.github_tips_enabled = condition;
+        AddPreconditionBit(GITHUB_TIPS, condition);
       } else if (kv.first == kAutoContribution) {
         preconditions_.auto_contribution_enabled = condition;
+        AddPreconditionBit(AUTO_CONTRIBUTION, condition);
       } else if (kv.first == kAds) {
         preconditions_.ads_enabled = condition;
+        AddPreconditionBit(ADS, condition);
       } else if (kv.first == kSupportsMinimumBraveVersion) {
         preconditions_.supports_minimum_brave_version = condition;
+        AddPreconditionBit(SUPPORTS_MINIMUM_BRAVE_VERSION, condition);
       } else {
         LOG(INFO) << "Greaselion encountered an unknown precondition: "
             << kv.first;
@@ -122,9 +131,11 @@ void GreaselionRule::Parse(base::DictionaryValue* preconditions_value,
     if (pattern.Parse(pattern_string) != URLPattern::ParseResult::kSuccess) {
       LOG(ERROR) << "Malformed pattern in Greaselion configuration";
       url_patterns_.clear();
+      parsed_url_patterns_.clear();
       return;
     }
     url_patterns_.push_back(pattern_string);
+    parsed_url_patterns_.push_back(std::move(pattern));
   }
   for (const auto& scripts_it : scripts_value->GetList()) {
     base::FilePath script_path = resource_dir.AppendASCII(
@@ -137,6 +148,8 @@ void GreaselionRule::Parse(base::DictionaryValue* preconditions_value,
   }
   run_at_ = run_at_value;
   minimum_brave_version_ = minimum_brave_version_value;
+  has_minimum_brave_version_ =
+      base::Version::IsValidWildcardString(minimum_brave_version_);
   if (!messages_value.empty()) {
     messages_ = resource_dir.Append(messages_value);
   }
@@ -144,45 +157,32 @@ void GreaselionRule::Parse(base::DictionaryValue* preconditions_value,
 
 GreaselionRule::~GreaselionRule() = default;
 
-bool GreaselionRule::PreconditionFulfilled(
-    GreaselionPreconditionValue precondition,
-    bool value) const {
-  switch (precondition) {
-    case kMustBeTrue:
-      return value;
-    case kMustBeFalse:
-      return !value;
-    default:
-      return true;
-  }
+void GreaselionRule::AddPreconditionBit(
+    GreaselionFeature feature,
+    GreaselionPreconditionValue precondition) {
+  const uint32_t bit = 1u << feature;
+  // A later value for the same key replaces the earlier one.
+  precondition_mask_ &= ~bit;
+  precondition_values_ &= ~bit;
+  if (precondition == kAny)
+    return;
+  precondition_mask_ |= bit;
+  if (precondition == kMustBeTrue)
+    precondition_values_ |= bit;
 }
 
 bool GreaselionRule::Matches(
     GreaselionFeatures state, const base::Version& browser_version) const {
+  return Matches(GreaselionFeaturesToBits(state), browser_version);
+}
+
+bool GreaselionRule::Matches(uint32_t features,
+                             const base::Version& browser_version) const {
   // Validate against preconditions.
-  if (!PreconditionFulfilled(preconditions_.rewards_enabled,
-                             state[greaselion::REWARDS]))
-    return false;
-  if (!PreconditionFulfilled(preconditions_.twitter_tips_enabled,
-                             state[greaselion::TWITTER_TIPS]))
-    return false;
-  if (!PreconditionFulfilled(preconditions_.reddit_tips_enabled,
-                             state[greaselion::REDDIT_TIPS]))
-    return false;
-  if (!PreconditionFulfilled(preconditions_.github_tips_enabled,
-                             state[greaselion::GITHUB_TIPS]))
-    return false;
-  if (!PreconditionFulfilled(preconditions_.auto_contribution_enabled,
-                             state[greaselion::AUTO_CONTRIBUTION]))
-    return false;
-  if (!PreconditionFulfilled(preconditions_.supports_minimum_brave_version,
-                          state[greaselion::SUPPORTS_MINIMUM_BRAVE_VERSION]))
-    return false;
-  if (!PreconditionFulfilled(preconditions_.ads_enabled,
-                             state[greaselion::ADS]))
+  if ((features & precondition_mask_) != precondition_values_)
     return false;
   // Validate against browser version.
-  if (base::Version::IsValidWildcardString(minimum_brave_version_)) {
+  if (has_minimum_brave_version_) {
     bool rule_version_is_higher_than_browser =
         (browser_version.CompareToWildcardString(minimum_brave_version_) < 0);
     if (rule_version_is_higher_than_browser) {
@@ -193,6 +193,24 @@ bool GreaselionRule::Matches(
   return true;
 }
 
+bool GreaselionRule::MatchesURL(const GURL& url) const {
+  for (const URLPattern& pattern : parsed_url_patterns_) {
+    if (pattern.MatchesURL(url))
+      return true;
+  }
+  return false;
+}
+
+uint32_t GreaselionFeaturesToBits(const GreaselionFeatures& state) {
+  static_assert(LAST_FEATURE <= 32, "Features must fit into a uint32_t");
+  uint32_t bits = 0;
+  for (const auto& feature : state) {
+    if (feature.second)
+      bits |= 1u << feature.first;
+  }
+  return bits;
+}
+
 GreaselionDownloadService::GreaselionDownloadService(
     LocalDataFilesService* local_data_files_service)
     : LocalDataFilesObserver(local_data_files_service), weak_factory_(this) {
@@ -316,10 +334,66 @@ void GreaselionDownloadService::OnDATFileDataReady(std::string contents) {
         minimum_brave_version_value, messages_path, resource_dir_);
     rules_.push_back(std::move(rule));
   }
+  BuildRuleIndex();
   for (Observer& observer : observers_)
     observer.OnRulesReady(this);
 }
 
+void GreaselionDownloadService::BuildRuleIndex() {
+  rules_by_host_.clear();
+  rules_for_any_host_.clear();
+  for (auto& rules : rules_by_feature_)
+    rules.clear();
+
+  for (size_t i = 0; i < rules_.size(); ++i) {
+    const GreaselionRule& rule = *rules_[i];
+    for (const URLPattern& pattern : rule.parsed_url_patterns()) {
+      std::vector<size_t>& rules = pattern.host().empty()
+                                       ? rules_for_any_host_
+                                       : rules_by_host_[pattern.host()];
+      // Several patterns of a rule may share a host.
+      if (rules.empty() || rules.back() != i)
+        rules.push_back(i);
+    }
+    for (int feature = FIRST_FEATURE; feature != LAST_FEATURE; ++feature) {
+      if (rule.DependsOn(static_cast<GreaselionFeature>(feature)))
+        rules_by_feature_[feature].push_back(i);
+    }
+  }
+}
+
+std::vector<const GreaselionRule*> GreaselionDownloadService::GetRulesForURL(
+    const GURL& url) const {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  base::flat_set<size_t> candidates(rules_for_any_host_.begin(),
+                                    rules_for_any_host_.end());
+  // Patterns matching subdomains are indexed under their parent domain, so
+  // probe the host and each of its parent domains.
+  base::StringPiece host = url.host_piece();
+  while (!host.empty()) {
+    auto it = rules_by_host_.find(std::string(host));
+    if (it != rules_by_host_.end())
+      candidates.insert(it->second.begin(), it->second.end());
+    const size_t dot = host.find('.');
+    if (dot == base::StringPiece::npos)
+      break;
+    host.remove_prefix(dot + 1);
+  }
+
+  std::vector<const GreaselionRule*> matching_rules;
+  for (size_t i : candidates) {
+    if (i < rules_.size() && rules_[i]->MatchesURL(url))
+      matching_rules.push_back(rules_[i].get());
+  }
+  return matching_rules;
+}
+
+const std::vector<size_t>& GreaselionDownloadService::GetRulesDependingOn(
+    GreaselionFeature feature) const {
+  DCHECK(feature >= FIRST_FEATURE && feature < LAST_FEATURE);
+  return rules_by_feature_[feature];
+}
+
 void GreaselionDownloadService::OnComponentReady(
     const std::string& component_id,
     const base::FilePath& install_dir,
@@ -328,6 +402,13 @@ void GreaselionDownloadService::OnComponentReady(
     return;
   }
   resource_dir_ = install_dir.AppendASCII(kGreaselionConfigFileVersion);
+  rules_version_.clear();
+  absl::optional<base::Value> manifest_value = base::JSONReader::Read(manifest);
+  if (manifest_value && manifest_value->is_dict()) {
+    const std::string* version = manifest_value->FindStringKey("version");
+    if (version)
+      rules_version_ = *version;
+  }
   LoadDirectlyFromResourcePath();
 }
 
@@ -337,6 +418,11 @@ GreaselionDownloadService::rules() {
   return &rules_;
 }
 
+const std::string& GreaselionDownloadService::rules_version() const {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  return rules_version_;
+}
+
 scoped_refptr<base::SequencedTaskRunner>
 GreaselionDownloadService::GetTaskRunner() {
   return local_data_files_service()->GetTaskRunner();
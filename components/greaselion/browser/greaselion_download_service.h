@@ -6,8 +6,10 @@
 #ifndef BRAVE_COMPONENTS_GREASELION_BROWSER_GREASELION_DOWNLOAD_SERVICE_H_
 #define BRAVE_COMPONENTS_GREASELION_BROWSER_GREASELION_DOWNLOAD_SERVICE_H_
 
+#include <array>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "base/files/file_path.h"
@@ -20,6 +22,7 @@
 #include "brave/components/brave_component_updater/browser/local_data_files_observer.h"
 #include "brave/components/greaselion/browser/greaselion_service.h"
 #include "content/public/browser/notification_types.h"
+#include "extensions/common/url_pattern.h"
 #include "extensions/common/url_pattern_set.h"
 #include "url/gurl.h"
 
@@ -65,8 +68,19 @@ class GreaselionRule {
              const base::FilePath& resource_dir);
   bool Matches(
       GreaselionFeatures state, const base::Version& browser_version) const;
+  // Same as above, with |features| holding one bit per GreaselionFeature as
+  // returned by GreaselionFeaturesToBits().
+  bool Matches(uint32_t features, const base::Version& browser_version) const;
+  bool MatchesURL(const GURL& url) const;
+  // Whether any precondition of this rule refers to |feature|.
+  bool DependsOn(GreaselionFeature feature) const {
+    return precondition_mask_ & (1u << feature);
+  }
   std::string name() const { return name_; }
   std::vector<std::string> url_patterns() const { return url_patterns_; }
+  const std::vector<URLPattern>& parsed_url_patterns() const {
+    return parsed_url_patterns_;
+  }
   std::vector<base::FilePath> scripts() const { return scripts_; }
   std::string run_at() const {
     return run_at_;
@@ -79,19 +93,27 @@ class GreaselionRule {
  private:
   scoped_refptr<base::SequencedTaskRunner> GetTaskRunner();
   GreaselionPreconditionValue ParsePrecondition(const base::Value& value);
-  bool PreconditionFulfilled(GreaselionPreconditionValue precondition,
-                             bool value) const;
+  void AddPreconditionBit(GreaselionFeature feature,
+                          GreaselionPreconditionValue precondition);
 
   std::string name_;
   std::vector<std::string> url_patterns_;
+  std::vector<URLPattern> parsed_url_patterns_;
   std::vector<base::FilePath> scripts_;
   std::string run_at_;
   std::string minimum_brave_version_;
   base::FilePath messages_;
+  bool has_minimum_brave_version_ = false;
   GreaselionPreconditions preconditions_;
+  // One bit per GreaselionFeature: |precondition_mask_| has the features this
+  // rule cares about, |precondition_values_| the values they must have.
+  uint32_t precondition_mask_ = 0;
+  uint32_t precondition_values_ = 0;
   bool has_unknown_preconditions_ = false;
 };
 
+uint32_t GreaselionFeaturesToBits(const GreaselionFeatures& state);
+
 // The Greaselion download service is in charge
 // of loading and parsing the Greaselion configuration file
 // and the scripts that the configuration file references
@@ -102,8 +124,20 @@ class GreaselionDownloadService : public LocalDataFilesObserver {
   ~GreaselionDownloadService() override;
 
   std::vector<std::unique_ptr<GreaselionRule>>* rules();
+  // Version of the component the rules were loaded from. Rule names are only
+  // stable within one version. Empty when loading from a local path.
+  const std::string& rules_version() const;
   scoped_refptr<base::SequencedTaskRunner> GetTaskRunner();
 
+  // Returns the rules with a URL pattern matching |url|. Only the rules
+  // indexed under the URL's host, its parent domains or any host are
+  // checked.
+  std::vector<const GreaselionRule*> GetRulesForURL(const GURL& url) const;
+  // Returns indices into rules() of the rules with a precondition on
+  // |feature|.
+  const std::vector<size_t>& GetRulesDependingOn(
+      GreaselionFeature feature) const;
+
   // implementation of LocalDataFilesObserver
   void OnComponentReady(const std::string& component_id,
                         const base::FilePath& install_dir,
@@ -126,10 +160,16 @@ class GreaselionDownloadService : public LocalDataFilesObserver {
   void OnDevModeLocalFileChanged(bool error);
   void LoadOnTaskRunner();
   void LoadDirectlyFromResourcePath();
+  void BuildRuleIndex();
 
   base::ObserverList<Observer> observers_;
   std::vector<std::unique_ptr<GreaselionRule>> rules_;
+  // Indices into |rules_|, rebuilt whenever the rules are loaded.
+  std::unordered_map<std::string, std::vector<size_t>> rules_by_host_;
+  std::vector<size_t> rules_for_any_host_;
+  std::array<std::vector<size_t>, LAST_FEATURE> rules_by_feature_;
   base::FilePath resource_dir_;
+  std::string rules_version_;
   bool is_dev_mode_ = false;
   scoped_refptr<base::SequencedTaskRunner> dev_mode_task_runner_;
   std::unique_ptr<base::FilePathWatcher> dev_mode_path_watcher_;
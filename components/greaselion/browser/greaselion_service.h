@@ -46,6 +46,13 @@ class GreaselionService : public KeyedService,
 
   virtual void SetFeatureEnabled(GreaselionFeature feature, bool enabled) = 0;
   virtual void UpdateInstalledExtensions() = 0;
+  // Called when a tab starts navigating or is redirected to |url|. Installs
+  // the extensions for rules matching |url| that were deferred by lazy
+  // install.
+  virtual void InstallExtensionsForURL(const GURL& url) = 0;
+  // Forgets the rules recorded by InstallExtensionsForURL, e.g. when the user
+  // clears their browsing history.
+  virtual void ClearRequestedRules() = 0;
   virtual bool IsGreaselionExtension(const std::string& id) = 0;
   virtual std::vector<extensions::ExtensionId> GetExtensionIdsForTesting() = 0;
   virtual bool ready() = 0;
@@ -15,6 +15,7 @@
 #include "base/bind.h"
 #include "base/callback_helpers.h"
 #include "base/command_line.h"
+#include "base/containers/contains.h"
 #include "base/feature_list.h"
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
@@ -29,9 +30,13 @@
 #include "base/version.h"
 #include "brave/components/brave_component_updater/browser/features.h"
 #include "brave/components/brave_component_updater/browser/switches.h"
+#include "brave/components/greaselion/browser/features.h"
 #include "brave/components/greaselion/browser/greaselion_download_service.h"
 #include "brave/components/version_info//version_info.h"
 #include "chrome/browser/extensions/extension_service.h"
+#include "components/prefs/pref_registry_simple.h"
+#include "components/prefs/pref_service.h"
+#include "components/prefs/scoped_user_pref_update.h"
 #include "components/version_info/version_info.h"
 #include "crypto/sha2.h"
 #include "extensions/browser/extension_registry.h"
@@ -52,6 +57,11 @@ namespace {
 
 constexpr char kRunAtDocumentStart[] = "document_start";
 
+// Rules requested by navigations, for lazy install
+constexpr char kRequestedRulesPref[] = "brave.greaselion.requested_rules";
+constexpr char kRulesVersionKey[] = "version";
+constexpr char kRuleNamesKey[] = "rules";
+
 // Wraps a Greaselion rule in a component. The component is stored as
 // an unpacked extension in the user data dir. Returns a valid
 // extension that the caller should take ownership of, or nullptr.
@@ -198,12 +208,16 @@ GreaselionServiceImpl::GreaselionServiceImpl(
     const base::FilePath& install_directory,
     extensions::ExtensionSystem* extension_system,
     extensions::ExtensionRegistry* extension_registry,
+    PrefService* prefs,
     scoped_refptr<base::SequencedTaskRunner> task_runner)
     : download_service_(download_service),
+      lazy_install_(
+          base::FeatureList::IsEnabled(features::kGreaselionLazyInstall)),
       install_directory_(install_directory),
       extension_system_(extension_system),
       extension_service_(extension_system->extension_service()),
       extension_registry_(extension_registry),
+      prefs_(prefs),
       all_rules_installed_successfully_(true),
       update_in_progress_(false),
       update_pending_(false),
@@ -223,6 +237,12 @@ GreaselionServiceImpl::~GreaselionServiceImpl() {
   extension_registry_->RemoveObserver(this);
 }
 
+// static
+void GreaselionServiceImpl::RegisterProfilePrefs(
+    PrefRegistrySimple* registry) {
+  registry->RegisterDictionaryPref(kRequestedRulesPref);
+}
+
 bool GreaselionServiceImpl::IsGreaselionExtension(const std::string& id) {
   return std::find(greaselion_extensions_.begin(), greaselion_extensions_.end(),
                    id) != greaselion_extensions_.end();
@@ -262,35 +282,118 @@ void GreaselionServiceImpl::UpdateInstalledExtensions() {
 void GreaselionServiceImpl::CreateAndInstallExtensions() {
   DCHECK(greaselion_extensions_.empty());
   DCHECK(update_in_progress_);
-  all_rules_installed_successfully_ = true;
-  pending_installs_ = 0;
-  std::vector<std::unique_ptr<GreaselionRule>>* rules =
-      download_service_->rules();
-  for (const std::unique_ptr<GreaselionRule>& rule : *rules) {
-    if (rule->Matches(state_, browser_version_) &&
-        rule->has_unknown_preconditions() == false) {
-      pending_installs_ += 1;
+  if (lazy_install_)
+    SyncRequestedRules();
+  std::vector<const GreaselionRule*> rules_to_install;
+  const uint32_t features = GreaselionFeaturesToBits(state_);
+  for (const std::unique_ptr<GreaselionRule>& rule :
+       *download_service_->rules()) {
+    if (rule->Matches(features, browser_version_) &&
+        rule->has_unknown_preconditions() == false &&
+        (!lazy_install_ || base::Contains(requested_rules_, rule->name()))) {
+      rules_to_install.push_back(rule.get());
     }
   }
+  all_rules_installed_successfully_ = true;
+  ConvertAndInstallRules(rules_to_install);
+}
+
+void GreaselionServiceImpl::ConvertAndInstallRules(
+    const std::vector<const GreaselionRule*>& rules) {
+  DCHECK(update_in_progress_);
+  pending_installs_ = static_cast<int>(rules.size());
   if (!pending_installs_) {
     // no rules match, nothing else to do
     MaybeNotifyObservers();
     return;
   }
-  for (const std::unique_ptr<GreaselionRule>& rule : *rules) {
-    if (rule->Matches(state_, browser_version_) &&
+  for (const GreaselionRule* rule : rules) {
+    // Convert script file to component extension. This must run on extension
+    // file task runner, which was passed in in the constructor.
+    GreaselionRule rule_copy(*rule);
+    base::PostTaskAndReplyWithResult(
+        task_runner_.get(), FROM_HERE,
+        base::BindOnce(&ConvertGreaselionRuleToExtensionOnTaskRunner,
+                       rule_copy, install_directory_),
+        base::BindOnce(&GreaselionServiceImpl::PostConvert,
+                       weak_factory_.GetWeakPtr()));
+  }
+}
+
+void GreaselionServiceImpl::InstallExtensionsForURL(const GURL& url) {
+  if (!lazy_install_ || !download_service_)
+    return;
+  SyncRequestedRules();
+  const uint32_t features = GreaselionFeaturesToBits(state_);
+  std::vector<const GreaselionRule*> new_rules;
+  bool requested_rules_changed = false;
+  for (const GreaselionRule* rule : download_service_->GetRulesForURL(url)) {
+    // Remember the rule even if it doesn't match the current state, so that
+    // it's installed if a later state change makes it match.
+    if (!requested_rules_.insert(rule->name()).second)
+      continue;
+    requested_rules_changed = true;
+    if (rule->Matches(features, browser_version_) &&
         rule->has_unknown_preconditions() == false) {
-      // Convert script file to component extension. This must run on extension
-      // file task runner, which was passed in in the constructor.
-      GreaselionRule rule_copy(*rule);
-      base::PostTaskAndReplyWithResult(
-          task_runner_.get(), FROM_HERE,
-          base::BindOnce(&ConvertGreaselionRuleToExtensionOnTaskRunner,
-                         rule_copy, install_directory_),
-          base::BindOnce(&GreaselionServiceImpl::PostConvert,
-                         weak_factory_.GetWeakPtr()));
+      new_rules.push_back(rule);
     }
   }
+  if (requested_rules_changed)
+    SaveRequestedRules();
+  if (new_rules.empty())
+    return;
+  if (update_in_progress_) {
+    // The pending update installs every requested rule.
+    update_pending_ = true;
+    return;
+  }
+  update_in_progress_ = true;
+  ConvertAndInstallRules(new_rules);
+}
+
+void GreaselionServiceImpl::ClearRequestedRules() {
+  // Extensions that are already installed stay loaded until the next update,
+  // so open tabs keep working; only the record of visited rules is dropped.
+  requested_rules_.clear();
+  prefs_->ClearPref(kRequestedRulesPref);
+}
+
+void GreaselionServiceImpl::SyncRequestedRules() {
+  // Nothing to match the saved names against until the rules are loaded.
+  if (download_service_->rules()->empty())
+    return;
+  const std::string& rules_version = download_service_->rules_version();
+  if (requested_rules_loaded_ && requested_rules_version_ == rules_version)
+    return;
+  requested_rules_loaded_ = true;
+  requested_rules_version_ = rules_version;
+  requested_rules_.clear();
+
+  // Rule names are positional, so names saved for another version of the
+  // rules could refer to different rules and are dropped.
+  const base::DictionaryValue* saved =
+      prefs_->GetDictionary(kRequestedRulesPref);
+  const std::string* saved_version = saved->FindStringKey(kRulesVersionKey);
+  if (!saved_version || *saved_version != rules_version) {
+    SaveRequestedRules();
+    return;
+  }
+  const base::Value* saved_names = saved->FindListKey(kRuleNamesKey);
+  if (!saved_names)
+    return;
+  for (const base::Value& name : saved_names->GetList()) {
+    if (name.is_string())
+      requested_rules_.insert(name.GetString());
+  }
+}
+
+void GreaselionServiceImpl::SaveRequestedRules() {
+  base::Value names(base::Value::Type::LIST);
+  for (const std::string& name : requested_rules_)
+    names.Append(base::Value(name));
+  DictionaryPrefUpdate update(prefs_, kRequestedRulesPref);
+  update->SetStringKey(kRulesVersionKey, requested_rules_version_);
+  update->SetKey(kRuleNamesKey, std::move(names));
 }
 
 void GreaselionServiceImpl::PostConvert(
@@ -370,8 +473,34 @@ void GreaselionServiceImpl::MaybeNotifyObservers() {
 void GreaselionServiceImpl::SetFeatureEnabled(GreaselionFeature feature,
                                               bool enabled) {
   DCHECK(feature >= 0 && feature < LAST_FEATURE);
+  if (state_[feature] == enabled)
+    return;
+  const bool rules_affected = AreRulesAffectedBy(feature, enabled);
   state_[feature] = enabled;
-  UpdateInstalledExtensions();
+  if (rules_affected)
+    UpdateInstalledExtensions();
+}
+
+bool GreaselionServiceImpl::AreRulesAffectedBy(GreaselionFeature feature,
+                                               bool enabled) const {
+  const std::vector<std::unique_ptr<GreaselionRule>>& rules =
+      *download_service_->rules();
+  const uint32_t old_features = GreaselionFeaturesToBits(state_);
+  const uint32_t new_features =
+      enabled ? old_features | (1u << feature) : old_features & ~(1u << feature);
+  // Only rules with a precondition on |feature| can change their result.
+  for (size_t i : download_service_->GetRulesDependingOn(feature)) {
+    if (i >= rules.size())
+      continue;
+    const GreaselionRule& rule = *rules[i];
+    if (lazy_install_ && !base::Contains(requested_rules_, rule.name()))
+      continue;
+    if (rule.Matches(old_features, browser_version_) !=
+        rule.Matches(new_features, browser_version_)) {
+      return true;
+    }
+  }
+  return false;
 }
 
 bool GreaselionServiceImpl::ready() {
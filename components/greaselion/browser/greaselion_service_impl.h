@@ -8,6 +8,7 @@
 
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -23,6 +24,9 @@
 #include "third_party/abseil-cpp/absl/types/optional.h"
 #include "url/gurl.h"
 
+class PrefRegistrySimple;
+class PrefService;
+
 namespace base {
 class SequencedTaskRunner;
 }
@@ -37,6 +41,7 @@ class ExtensionSystem;
 namespace greaselion {
 
 class GreaselionDownloadService;
+class GreaselionRule;
 
 class GreaselionServiceImpl : public GreaselionService {
  public:
@@ -45,12 +50,17 @@ class GreaselionServiceImpl : public GreaselionService {
       const base::FilePath& install_directory,
       extensions::ExtensionSystem* extension_system,
       extensions::ExtensionRegistry* extension_registry,
+      PrefService* prefs,
       scoped_refptr<base::SequencedTaskRunner> task_runner);
   ~GreaselionServiceImpl() override;
 
+  static void RegisterProfilePrefs(PrefRegistrySimple* registry);
+
   // GreaselionService overrides
   void SetFeatureEnabled(GreaselionFeature feature, bool enabled) override;
   void UpdateInstalledExtensions() override;
+  void InstallExtensionsForURL(const GURL& url) override;
+  void ClearRequestedRules() override;
   bool IsGreaselionExtension(const std::string& id) override;
   std::vector<extensions::ExtensionId> GetExtensionIdsForTesting() override;
   bool ready() override;
@@ -70,17 +80,32 @@ class GreaselionServiceImpl : public GreaselionService {
  private:
   void SetBrowserVersionForTesting(const base::Version& version) override;
   void CreateAndInstallExtensions();
+  void ConvertAndInstallRules(const std::vector<const GreaselionRule*>& rules);
+  // Reloads |requested_rules_| from prefs when the rules version changed
+  // since they were last loaded.
+  void SyncRequestedRules();
+  void SaveRequestedRules();
+  // Whether switching |feature| to |enabled| changes which rules match.
+  bool AreRulesAffectedBy(GreaselionFeature feature, bool enabled) const;
   void PostConvert(
       absl::optional<GreaselionConvertedExtension> converted_extension);
   void Install(scoped_refptr<extensions::Extension> extension);
   void MaybeNotifyObservers();
 
   GreaselionDownloadService* download_service_;  // NOT OWNED
+  // When set, only rules in |requested_rules_| get an extension installed.
+  const bool lazy_install_;
+  // Names of the rules matching a URL the user navigated to, persisted in
+  // prefs. Rule names are only valid for |requested_rules_version_|.
+  std::set<std::string> requested_rules_;
+  std::string requested_rules_version_;
+  bool requested_rules_loaded_ = false;
   GreaselionFeatures state_;
   const base::FilePath install_directory_;
   extensions::ExtensionSystem* extension_system_;      // NOT OWNED
   extensions::ExtensionService* extension_service_;    // NOT OWNED
   extensions::ExtensionRegistry* extension_registry_;  // NOT OWNED
+  PrefService* prefs_;                                 // NOT OWNED
   bool all_rules_installed_successfully_;
   bool update_in_progress_;
   bool update_pending_;
@@ -25,6 +25,9 @@ namespace ntp_background_images {
 
 namespace {
 
+// Enough for a few backgrounds plus their logos.
+constexpr size_t kMaxCachedImageBytes = 16 * 1024 * 1024;
+
 absl::optional<std::string> ReadFileToString(const base::FilePath& path) {
   std::string contents;
   if (!base::ReadFileToString(path, &contents))
@@ -41,6 +44,9 @@ bool IsSuperReferralPath(const std::string& path) {
 NTPBackgroundImagesSource::NTPBackgroundImagesSource(
     NTPBackgroundImagesService* service)
     : service_(service),
+      image_cache_(base::MRUCache<base::FilePath,
+                                  scoped_refptr<base::RefCountedMemory>>::
+                       NO_AUTO_EVICT),
       weak_factory_(this) {
 }
 
@@ -99,25 +105,58 @@ void NTPBackgroundImagesSource::StartDataRequest(
 void NTPBackgroundImagesSource::GetImageFile(
     const base::FilePath& image_file_path,
     GotDataCallback callback) {
+  auto iter = image_cache_.Get(image_file_path);
+  if (iter != image_cache_.end()) {
+    std::move(callback).Run(iter->second);
+    return;
+  }
+
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock()},
       base::BindOnce(&ReadFileToString, image_file_path),
       base::BindOnce(&NTPBackgroundImagesSource::OnGotImageFile,
-                     weak_factory_.GetWeakPtr(), std::move(callback)));
+                     weak_factory_.GetWeakPtr(), image_file_path,
+                     std::move(callback)));
 }
 
 void NTPBackgroundImagesSource::OnGotImageFile(
+    const base::FilePath& image_file_path,
     GotDataCallback callback,
     absl::optional<std::string> input) {
   if (!input)
     return;
 
-  scoped_refptr<base::RefCountedMemory> bytes;
-  bytes = new base::RefCountedBytes(
-       reinterpret_cast<const unsigned char*>(input->c_str()), input->length());
+  // Take over the string's buffer instead of copying the image.
+  scoped_refptr<base::RefCountedMemory> bytes =
+      base::RefCountedString::TakeString(&*input);
+  AddImageToCache(image_file_path, bytes);
   std::move(callback).Run(std::move(bytes));
 }
 
+void NTPBackgroundImagesSource::AddImageToCache(
+    const base::FilePath& image_file_path,
+    scoped_refptr<base::RefCountedMemory> bytes) {
+  if (bytes->size() > kMaxCachedImageBytes)
+    return;
+
+  // Concurrent requests for the same file can both miss; keep the latest.
+  auto iter = image_cache_.Peek(image_file_path);
+  if (iter != image_cache_.end()) {
+    cached_image_bytes_ -= iter->second->size();
+    image_cache_.Erase(iter);
+  }
+
+  while (cached_image_bytes_ + bytes->size() > kMaxCachedImageBytes) {
+    auto oldest = image_cache_.rbegin();
+    DCHECK(oldest != image_cache_.rend());
+    cached_image_bytes_ -= oldest->second->size();
+    image_cache_.Erase(oldest);
+  }
+
+  cached_image_bytes_ += bytes->size();
+  image_cache_.Put(image_file_path, std::move(bytes));
+}
+
 std::string NTPBackgroundImagesSource::GetMimeType(const std::string& path) {
   if (IsLogoPath(path) || IsTopSiteFaviconPath(path))
     return "image/png";
@@ -8,14 +8,13 @@
 
 #include <string>
 
+#include "base/containers/mru_cache.h"
+#include "base/files/file_path.h"
+#include "base/memory/ref_counted_memory.h"
 #include "base/memory/weak_ptr.h"
 #include "content/public/browser/url_data_source.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 
-namespace base {
-class FilePath;
-}  // namespace base
-
 namespace ntp_background_images {
 
 class NTPBackgroundImagesService;
@@ -35,6 +34,7 @@ class NTPBackgroundImagesSource : public content::URLDataSource {
   FRIEND_TEST_ALL_PREFIXES(NTPBackgroundImagesSourceTest, BasicTest);
   FRIEND_TEST_ALL_PREFIXES(NTPBackgroundImagesSourceTest,
                            BasicSuperReferralDataTest);
+  FRIEND_TEST_ALL_PREFIXES(NTPBackgroundImagesSourceTest, ImageCacheTest);
 
   // content::URLDataSource overrides:
   std::string GetSource() override;
@@ -46,8 +46,11 @@ class NTPBackgroundImagesSource : public content::URLDataSource {
 
   void GetImageFile(const base::FilePath& image_file_path,
                     GotDataCallback callback);
-  void OnGotImageFile(GotDataCallback callback,
+  void OnGotImageFile(const base::FilePath& image_file_path,
+                      GotDataCallback callback,
                       absl::optional<std::string> input);
+  void AddImageToCache(const base::FilePath& image_file_path,
+                       scoped_refptr<base::RefCountedMemory> bytes);
   bool IsValidPath(const std::string& path) const;
   bool IsLogoPath(const std::string& path) const;
   bool IsDefaultLogoPath(const std::string& path) const;
@@ -58,6 +61,14 @@ class NTPBackgroundImagesSource : public content::URLDataSource {
   base::FilePath GetTopSiteFaviconFilePath(const std::string& path) const;
 
   NTPBackgroundImagesService* service_;  // not owned
+  // Recently served image files, so opening new tabs doesn't read the same
+  // multi-megabyte background from disk every time. Keyed by the absolute
+  // file path, which includes the versioned component install directory, so
+  // a component update never hits stale data. Bounded by
+  // |cached_image_bytes_| rather than by entry count.
+  base::MRUCache<base::FilePath, scoped_refptr<base::RefCountedMemory>>
+      image_cache_;
+  size_t cached_image_bytes_ = 0;
   base::WeakPtrFactory<NTPBackgroundImagesSource> weak_factory_;
 };
 
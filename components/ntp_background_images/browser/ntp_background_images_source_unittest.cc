@@ -6,6 +6,10 @@
 #include <memory>
 #include <string>
 
+#include "base/files/file_util.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/memory/ref_counted_memory.h"
+#include "base/test/bind.h"
 #include "base/test/task_environment.h"
 #include "brave/components/brave_referrals/browser/brave_referrals_service.h"
 #include "brave/components/brave_referrals/buildflags/buildflags.h"
@@ -32,7 +36,7 @@ class NTPBackgroundImagesSourceTest : public testing::Test {
                     base::Value(base::Value::Type::DICTIONARY));
   }
 
-  base::test::SingleThreadTaskEnvironment task_environment;
+  base::test::TaskEnvironment task_environment;
   TestingPrefServiceSimple local_pref_;
   std::unique_ptr<NTPBackgroundImagesService> service_;
   std::unique_ptr<NTPBackgroundImagesSource> source_;
@@ -78,6 +82,32 @@ TEST_F(NTPBackgroundImagesSourceTest, BasicTest) {
       source_->GetWallpaperIndexFromPath("sponsored-images/wallpaper-3.jpg"));
 }
 
+TEST_F(NTPBackgroundImagesSourceTest, ImageCacheTest) {
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  const base::FilePath image_path =
+      temp_dir.GetPath().AppendASCII("background-1.jpg");
+  ASSERT_TRUE(base::WriteFile(image_path, "image data"));
+
+  std::string data;
+  auto on_got_data = [&data](scoped_refptr<base::RefCountedMemory> bytes) {
+    ASSERT_TRUE(bytes);
+    data = std::string(bytes->front_as<char>(), bytes->size());
+  };
+
+  source_->GetImageFile(image_path, base::BindLambdaForTesting(on_got_data));
+  task_environment.RunUntilIdle();
+  EXPECT_EQ("image data", data);
+  EXPECT_EQ(10u, source_->cached_image_bytes_);
+
+  // Second request is answered from memory without touching the file.
+  data.clear();
+  ASSERT_TRUE(base::DeleteFile(image_path));
+  source_->GetImageFile(image_path, base::BindLambdaForTesting(on_got_data));
+  EXPECT_EQ("image data", data);
+  EXPECT_EQ(1u, source_->image_cache_.size());
+}
+
 #if BUILDFLAG(ENABLE_BRAVE_REFERRALS)
 
 #if !defined(OS_LINUX)
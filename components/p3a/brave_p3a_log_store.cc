@@ -5,6 +5,7 @@
 
 #include "brave/components/p3a/brave_p3a_log_store.h"
 
+#include "base/containers/contains.h"
 #include "base/logging.h"
 #include "base/metrics/histogram_macros.h"
 #include "base/rand_util.h"
@@ -22,6 +23,11 @@ constexpr char kLogValueKey[] = "value";
 constexpr char kLogSentKey[] = "sent";
 constexpr char kLogTimestampKey[] = "timestamp";
 
+bool IsP2AMetric(base::StringPiece histogram_name) {
+  return base::StartsWith(histogram_name, "Brave.P2A",
+                          base::CompareCase::SENSITIVE);
+}
+
 void RecordP3A(uint64_t answers_count) {
   int answer = 0;
   if (1 <= answers_count && answers_count < 5) {
@@ -74,8 +80,10 @@ void BraveP3ALogStore::RemoveValueIfExists(const std::string& histogram_name) {
   DictionaryPrefUpdate update(local_state_, kPrefName);
   update->RemovePath(histogram_name);
 
-  if (has_staged_log() && staged_entry_key_ == histogram_name) {
-    staged_entry_key_.clear();
+  // The staged log can't be partially updated, so unstage all of it. Other
+  // values in it stay unsent and will be staged again.
+  if (base::Contains(staged_entry_keys_, histogram_name)) {
+    staged_entry_keys_.clear();
     staged_log_.clear();
   }
 }
@@ -111,27 +119,17 @@ bool BraveP3ALogStore::has_unsent_logs() const {
 }
 
 bool BraveP3ALogStore::has_staged_log() const {
-  return !staged_entry_key_.empty();
+  return !staged_entry_keys_.empty();
 }
 
 const std::string& BraveP3ALogStore::staged_log() const {
-  DCHECK(!staged_entry_key_.empty());
-  auto iter = log_.find(staged_entry_key_);
-  DCHECK(iter != log_.end());
-
+  DCHECK(has_staged_log());
   return staged_log_;
 }
 
 std::string BraveP3ALogStore::staged_log_type() const {
-  DCHECK(!staged_entry_key_.empty());
-  auto iter = log_.find(staged_entry_key_);
-  DCHECK(iter != log_.end());
-
-  if (base::StartsWith(iter->first, "Brave.P2A",
-                       base::CompareCase::SENSITIVE)) {
-    return "p2a";
-  }
-  return "p3a";
+  DCHECK(has_staged_log());
+  return IsP2AMetric(staged_entry_keys_.front()) ? "p2a" : "p3a";
 }
 
 const std::string& BraveP3ALogStore::staged_log_hash() const {
@@ -148,13 +146,38 @@ void BraveP3ALogStore::StageNextLog() {
   // Stage the next item.
   DCHECK(has_unsent_logs());
   uint64_t rand_idx = base::RandGenerator(unsent_entries_.size());
-  staged_entry_key_ = *(unsent_entries_.begin() + rand_idx);
-  DCHECK(!log_.find(staged_entry_key_)->second.sent);
+  const std::string& first_key = *(unsent_entries_.begin() + rand_idx);
+  DCHECK(!log_.find(first_key)->second.sent);
+  staged_entry_keys_ = {first_key};
+
+  if (max_batch_size_ > 1 && !IsP2AMetric(first_key)) {
+    // Fill the rest of the batch with other unsent P3A values, in random
+    // order so the batch contents don't depend on metric names.
+    std::vector<std::string> candidates;
+    for (const std::string& key : unsent_entries_) {
+      if (key != first_key && !IsP2AMetric(key))
+        candidates.push_back(key);
+    }
+    base::RandomShuffle(candidates.begin(), candidates.end());
+    for (std::string& key : candidates) {
+      if (staged_entry_keys_.size() >= max_batch_size_)
+        break;
+      staged_entry_keys_.push_back(std::move(key));
+    }
+  }
 
-  uint64_t staged_entry_value = log_[staged_entry_key_].value;
-  staged_log_ = delegate_->Serialize(staged_entry_key_, staged_entry_value);
+  if (staged_entry_keys_.size() == 1) {
+    staged_log_ = delegate_->Serialize(first_key, log_[first_key].value);
+  } else {
+    std::vector<std::pair<std::string, uint64_t>> entries;
+    for (const std::string& key : staged_entry_keys_)
+      entries.emplace_back(key, log_[key].value);
+    staged_log_ = delegate_->SerializeBatch(entries);
+  }
 
-  VLOG(2) << "BraveP3ALogStore::StageNextLog: staged " << staged_entry_key_;
+  VLOG(2) << "BraveP3ALogStore::StageNextLog: staged "
+          << staged_entry_keys_.size() << " value(s), first is "
+          << staged_entry_keys_.front();
 }
 
 void BraveP3ALogStore::DiscardStagedLog() {
@@ -162,24 +185,26 @@ void BraveP3ALogStore::DiscardStagedLog() {
     return;
   }
 
-  // Mark previous staged log as sent.
-  auto log_iter = log_.find(staged_entry_key_);
-  DCHECK(log_iter != log_.end());
-  log_iter->second.MarkAsSent();
-
-  // Update the persistent value.
+  // Mark previous staged values as sent.
   DictionaryPrefUpdate update(local_state_, kPrefName);
-  update->SetPath({log_iter->first, kLogSentKey},
-                  base::Value(log_iter->second.sent));
-  update->SetPath({log_iter->first, kLogTimestampKey},
-                  base::Value(log_iter->second.sent_timestamp.ToDoubleT()));
-
-  // Erase the entry from the unsent queue.
-  auto unsent_entries_iter = unsent_entries_.find(staged_entry_key_);
-  DCHECK(unsent_entries_iter != unsent_entries_.end());
-  unsent_entries_.erase(unsent_entries_iter);
+  for (const std::string& key : staged_entry_keys_) {
+    auto log_iter = log_.find(key);
+    DCHECK(log_iter != log_.end());
+    log_iter->second.MarkAsSent();
+
+    // Update the persistent value.
+    update->SetPath({log_iter->first, kLogSentKey},
+                    base::Value(log_iter->second.sent));
+    update->SetPath({log_iter->first, kLogTimestampKey},
+                    base::Value(log_iter->second.sent_timestamp.ToDoubleT()));
+
+    // Erase the entry from the unsent queue.
+    auto unsent_entries_iter = unsent_entries_.find(key);
+    DCHECK(unsent_entries_iter != unsent_entries_.end());
+    unsent_entries_.erase(unsent_entries_iter);
+  }
 
-  staged_entry_key_.clear();
+  staged_entry_keys_.clear();
   staged_log_.clear();
 }
 
@@ -7,7 +7,10 @@
 #define BRAVE_COMPONENTS_P3A_BRAVE_P3A_LOG_STORE_H_
 
 #include <string>
+#include <utility>
+#include <vector>
 
+#include "base/check_op.h"
 #include "base/containers/flat_map.h"
 #include "base/containers/flat_set.h"
 #include "base/strings/string_piece.h"
@@ -30,6 +33,9 @@ class BraveP3ALogStore : public metrics::LogStore {
     // Prepares a string representaion of an entry.
     virtual std::string Serialize(base::StringPiece histogram_name,
                                   uint64_t value) = 0;
+    // Prepares a single string representation of several entries.
+    virtual std::string SerializeBatch(
+        const std::vector<std::pair<std::string, uint64_t>>& entries) = 0;
     // Returns false if the metric is obsolete and should be cleaned up.
     virtual bool IsActualMetric(base::StringPiece histogram_name) const = 0;
     virtual ~Delegate() {}
@@ -49,6 +55,13 @@ class BraveP3ALogStore : public metrics::LogStore {
   // Marks all saved values as unsent.
   void ResetUploadStamps();
 
+  // Lets |StageNextLog()| pack up to |max_batch_size| P3A values into one log.
+  // P2A values are always staged one at a time.
+  void set_max_batch_size(size_t max_batch_size) {
+    DCHECK_GE(max_batch_size, 1u);
+    max_batch_size_ = max_batch_size;
+  }
+
   // metrics::LogStore:
   bool has_unsent_logs() const override;
   bool has_staged_log() const override;
@@ -91,7 +104,9 @@ class BraveP3ALogStore : public metrics::LogStore {
   base::flat_map<std::string, LogEntry> log_;
   base::flat_set<std::string> unsent_entries_;
 
-  std::string staged_entry_key_;
+  size_t max_batch_size_ = 1u;
+  // Keys of the values in |staged_log_|, all of the same log type.
+  std::vector<std::string> staged_entry_keys_;
   std::string staged_log_;
 
   // Not used for now.
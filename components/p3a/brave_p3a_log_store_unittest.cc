@@ -0,0 +1,125 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/p3a/brave_p3a_log_store.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/strings/string_number_conversions.h"
+#include "components/prefs/testing_pref_service.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave {
+
+namespace {
+
+// Serializes entries as "name=value" lines so tests can see what was staged.
+class FakeDelegate : public BraveP3ALogStore::Delegate {
+ public:
+  std::string Serialize(base::StringPiece histogram_name,
+                        uint64_t value) override {
+    return std::string(histogram_name) + "=" + base::NumberToString(value) +
+           "\n";
+  }
+
+  std::string SerializeBatch(
+      const std::vector<std::pair<std::string, uint64_t>>& entries) override {
+    std::string result;
+    for (const auto& entry : entries)
+      result += Serialize(entry.first, entry.second);
+    return result;
+  }
+
+  bool IsActualMetric(base::StringPiece histogram_name) const override {
+    return true;
+  }
+};
+
+}  // namespace
+
+class BraveP3ALogStoreTest : public testing::Test {
+ public:
+  BraveP3ALogStoreTest() {
+    BraveP3ALogStore::RegisterPrefs(local_state_.registry());
+    log_store_ = std::make_unique<BraveP3ALogStore>(&delegate_, &local_state_);
+  }
+
+ protected:
+  TestingPrefServiceSimple local_state_;
+  FakeDelegate delegate_;
+  std::unique_ptr<BraveP3ALogStore> log_store_;
+};
+
+TEST_F(BraveP3ALogStoreTest, StagesOneValueByDefault) {
+  log_store_->UpdateValue("Brave.Test.A", 1);
+  log_store_->UpdateValue("Brave.Test.B", 2);
+
+  log_store_->StageNextLog();
+  ASSERT_TRUE(log_store_->has_staged_log());
+  EXPECT_EQ(log_store_->staged_log().find('\n'),
+            log_store_->staged_log().size() - 1);
+  log_store_->DiscardStagedLog();
+  EXPECT_TRUE(log_store_->has_unsent_logs());
+
+  log_store_->StageNextLog();
+  log_store_->DiscardStagedLog();
+  EXPECT_FALSE(log_store_->has_unsent_logs());
+}
+
+TEST_F(BraveP3ALogStoreTest, StagesBatches) {
+  log_store_->set_max_batch_size(2);
+  log_store_->UpdateValue("Brave.Test.A", 1);
+  log_store_->UpdateValue("Brave.Test.B", 2);
+  log_store_->UpdateValue("Brave.Test.C", 3);
+  log_store_->UpdateValue("Brave.P2A.Test", 4);
+
+  // P2A values go to another endpoint and are never batched.
+  size_t p3a_uploads = 0;
+  size_t p3a_values = 0;
+  while (log_store_->has_unsent_logs()) {
+    log_store_->StageNextLog();
+    const std::string log = log_store_->staged_log();
+    const size_t values = std::count(log.begin(), log.end(), '\n');
+    if (log_store_->staged_log_type() == "p2a") {
+      EXPECT_EQ(log, "Brave.P2A.Test=4\n");
+    } else {
+      EXPECT_LE(values, 2u);
+      EXPECT_EQ(log.find("Brave.P2A"), std::string::npos);
+      ++p3a_uploads;
+      p3a_values += values;
+    }
+    log_store_->DiscardStagedLog();
+  }
+  EXPECT_EQ(p3a_values, 3u);
+  EXPECT_EQ(p3a_uploads, 2u);
+
+  // Every value in a batch is marked as sent and is sent again after
+  // rotation.
+  log_store_->ResetUploadStamps();
+  EXPECT_TRUE(log_store_->has_unsent_logs());
+}
+
+TEST_F(BraveP3ALogStoreTest, RemovingValueUnstagesBatch) {
+  log_store_->set_max_batch_size(2);
+  log_store_->UpdateValue("Brave.Test.A", 1);
+  log_store_->UpdateValue("Brave.Test.B", 2);
+
+  log_store_->StageNextLog();
+  ASSERT_TRUE(log_store_->has_staged_log());
+  log_store_->RemoveValueIfExists("Brave.Test.A");
+  EXPECT_FALSE(log_store_->has_staged_log());
+
+  // The other value is still waiting to be sent.
+  log_store_->StageNextLog();
+  EXPECT_EQ(log_store_->staged_log(), "Brave.Test.B=2\n");
+  log_store_->DiscardStagedLog();
+  EXPECT_FALSE(log_store_->has_unsent_logs());
+}
+
+}  // namespace brave
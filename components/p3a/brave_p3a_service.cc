@@ -5,6 +5,7 @@
 
 #include "brave/components/p3a/brave_p3a_service.h"
 
+#include <limits>
 #include <memory>
 #include <string>
 #include <utility>
@@ -18,6 +19,7 @@
 #include "base/metrics/statistics_recorder.h"
 #include "base/no_destructor.h"
 #include "base/rand_util.h"
+#include "base/stl_util.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/task/post_task.h"
 #include "base/trace_event/trace_event.h"
@@ -47,6 +49,8 @@ namespace {
 // should be refactored in better times.
 constexpr int32_t kSuspendedMetricValue = INT_MAX - 1;
 constexpr uint64_t kSuspendedMetricBucket = INT_MAX - 1;
+static_assert(kSuspendedMetricValue == kSuspendedMetricBucket,
+              "Suspended metrics are recognized by sample and by bucket");
 
 constexpr char kLastRotationTimeStampPref[] = "p3a.last_rotation_timestamp";
 
@@ -55,6 +59,14 @@ constexpr char kP2AServerUrl[] = "https://p2a.brave.com/";
 
 constexpr uint64_t kDefaultUploadIntervalSeconds = 60;  // 1 minute.
 
+// Marks an empty slot in |pending_buckets_|.
+constexpr uint64_t kNoPendingBucket = std::numeric_limits<uint64_t>::max();
+
+// How long histogram changes are collected before they are handled on UI
+// thread.
+constexpr base::TimeDelta kPendingBucketsDrainDelay =
+    base::TimeDelta::FromSeconds(1);
+
 // TODO(iefremov): Provide moar histograms!
 // Whitelist for histograms that we collect. Will be replaced with something
 // updating on the fly.
@@ -201,7 +213,13 @@ BraveP3AService::BraveP3AService(PrefService* local_state,
                                  std::string week_of_install)
     : local_state_(std::move(local_state)),
       channel_(std::move(channel)),
-      week_of_install_(week_of_install) {}
+      week_of_install_(week_of_install),
+      pending_buckets_(std::make_unique<std::atomic<uint64_t>[]>(
+          base::size(kCollectedHistograms))) {
+  for (size_t i = 0; i < base::size(kCollectedHistograms); ++i) {
+    pending_buckets_[i].store(kNoPendingBucket);
+  }
+}
 
 BraveP3AService::~BraveP3AService() = default;
 
@@ -216,12 +234,13 @@ void BraveP3AService::RegisterPrefs(PrefRegistrySimple* registry,
 }
 
 void BraveP3AService::InitCallbacks() {
-  for (const char* histogram_name : kCollectedHistograms) {
+  for (size_t i = 0; i < base::size(kCollectedHistograms); ++i) {
     histogram_sample_callbacks_.push_back(
         std::make_unique<
             base::StatisticsRecorder::ScopedHistogramSampleObserver>(
-            histogram_name,
-            base::BindRepeating(&BraveP3AService::OnHistogramChanged, this)));
+            kCollectedHistograms[i],
+            base::BindRepeating(&BraveP3AService::OnHistogramChanged, this,
+                                i)));
   }
 }
 
@@ -241,12 +260,14 @@ void BraveP3AService::Init(
           << ", average_upload_interval_ = " << average_upload_interval_
           << ", randomize_upload_interval_ = " << randomize_upload_interval_
           << ", upload_server_url_ = " << upload_server_url_.spec()
-          << ", rotation_interval_ = " << rotation_interval_;
+          << ", rotation_interval_ = " << rotation_interval_
+          << ", upload_batch_size_ = " << upload_batch_size_;
 
   InitPyxisMeta();
 
   // Init log store.
   log_store_.reset(new BraveP3ALogStore(this, local_state_));
+  log_store_->set_max_batch_size(upload_batch_size_);
   log_store_->LoadPersistedUnsentLogs();
   // Store values that were recorded between calling constructor and |Init()|.
   for (const auto& entry : histogram_values_) {
@@ -307,6 +328,17 @@ std::string BraveP3AService::Serialize(base::StringPiece histogram_name,
   return message.SerializeAsString();
 }
 
+std::string BraveP3AService::SerializeBatch(
+    const std::vector<std::pair<std::string, uint64_t>>& entries) {
+  UpdatePyxisMeta();
+  brave_pyxis::RawP3AValueBatch batch;
+  for (const auto& entry : entries) {
+    prochlo::GenerateP3AMessage(base::HashMetricName(entry.first),
+                                entry.second, pyxis_meta_, batch.add_values());
+  }
+  return batch.SerializeAsString();
+}
+
 bool
 BraveP3AService::IsActualMetric(base::StringPiece histogram_name) const {
   static const base::NoDestructor<base::flat_set<base::StringPiece>>
@@ -347,6 +379,15 @@ void BraveP3AService::MaybeOverrideSettingsFromCommandLine() {
       upload_server_url_ = url;
     }
   }
+
+  if (cmdline->HasSwitch(switches::kP3AUploadBatchSize)) {
+    std::string batch_size_str =
+        cmdline->GetSwitchValueASCII(switches::kP3AUploadBatchSize);
+    size_t batch_size;
+    if (base::StringToSizeT(batch_size_str, &batch_size) && batch_size > 0) {
+      upload_batch_size_ = batch_size;
+    }
+  }
 }
 
 void BraveP3AService::InitPyxisMeta() {
@@ -406,7 +447,8 @@ void BraveP3AService::StartScheduledUpload() {
   }
 }
 
-void BraveP3AService::OnHistogramChanged(const char* histogram_name,
+void BraveP3AService::OnHistogramChanged(size_t histogram_index,
+                                         const char* histogram_name,
                                          uint64_t name_hash,
                                          base::HistogramBase::Sample sample) {
   std::unique_ptr<base::HistogramSamples> samples =
@@ -419,12 +461,7 @@ void BraveP3AService::OnHistogramChanged(const char* histogram_name,
   // Shortcut for the special values, see |kSuspendedMetricValue|
   // description for details.
   if (IsSuspendedMetric(histogram_name, sample)) {
-    base::PostTask(FROM_HERE, {content::BrowserThread::UI},
-                   base::BindOnce(&BraveP3AService::OnHistogramChangedOnUI,
-                                  this,
-                                  histogram_name,
-                                  kSuspendedMetricValue,
-                                  kSuspendedMetricBucket));
+    SetPendingBucket(histogram_index, kSuspendedMetricBucket);
     return;
   }
 
@@ -453,16 +490,38 @@ void BraveP3AService::OnHistogramChanged(const char* histogram_name,
     bucket = DirectEncodingProtocol::Perturb(bucket_count, bucket);
   }
 
-  base::PostTask(FROM_HERE, {content::BrowserThread::UI},
-                 base::BindOnce(&BraveP3AService::OnHistogramChangedOnUI, this,
-                                histogram_name, sample, bucket));
+  SetPendingBucket(histogram_index, bucket);
+}
+
+void BraveP3AService::SetPendingBucket(size_t histogram_index,
+                                       uint64_t bucket) {
+  DCHECK_LT(histogram_index, base::size(kCollectedHistograms));
+  pending_buckets_[histogram_index].store(bucket);
+  // The drain clears |drain_scheduled_| before reading the slots, so either
+  // this store is seen by a drain that is already scheduled or we schedule a
+  // new one.
+  if (!drain_scheduled_.exchange(true)) {
+    base::PostDelayedTask(
+        FROM_HERE, {content::BrowserThread::UI},
+        base::BindOnce(&BraveP3AService::DrainPendingBuckets, this),
+        kPendingBucketsDrainDelay);
+  }
+}
+
+void BraveP3AService::DrainPendingBuckets() {
+  drain_scheduled_.store(false);
+  for (size_t i = 0; i < base::size(kCollectedHistograms); ++i) {
+    const uint64_t bucket = pending_buckets_[i].exchange(kNoPendingBucket);
+    if (bucket != kNoPendingBucket) {
+      OnHistogramChangedOnUI(kCollectedHistograms[i], bucket);
+    }
+  }
 }
 
 void BraveP3AService::OnHistogramChangedOnUI(const char* histogram_name,
-                                             base::HistogramBase::Sample sample,
                                              size_t bucket) {
   VLOG(2) << "BraveP3AService::OnHistogramChanged: histogram_name = "
-          << histogram_name << " Sample = " << sample << " bucket = " << bucket;
+          << histogram_name << " bucket = " << bucket;
   if (!initialized_) {
     // Will handle it later when ready.
     histogram_values_[histogram_name] = bucket;
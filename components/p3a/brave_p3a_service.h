@@ -6,11 +6,14 @@
 #ifndef BRAVE_COMPONENTS_P3A_BRAVE_P3A_SERVICE_H_
 #define BRAVE_COMPONENTS_P3A_BRAVE_P3A_SERVICE_H_
 
+#include <atomic>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "base/containers/flat_map.h"
+#include "base/gtest_prod_util.h"
 #include "base/memory/ref_counted.h"
 #include "base/metrics/histogram_base.h"
 #include "base/metrics/statistics_recorder.h"
@@ -54,12 +57,15 @@ class BraveP3AService : public base::RefCountedThreadSafe<BraveP3AService>,
   // BraveP3ALogStore::Delegate
   std::string Serialize(base::StringPiece histogram_name,
                         uint64_t value) override;
+  std::string SerializeBatch(
+      const std::vector<std::pair<std::string, uint64_t>>& entries) override;
 
   // May be accessed from multiple threads, so this is thread-safe.
   bool IsActualMetric(base::StringPiece histogram_name) const override;
 
  private:
   friend class base::RefCountedThreadSafe<BraveP3AService>;
+  FRIEND_TEST_ALL_PREFIXES(BraveP3AServiceTest, CoalescesSamplesFromManyThreads);
   ~BraveP3AService() override;
 
   void MaybeOverrideSettingsFromCommandLine();
@@ -72,14 +78,22 @@ class BraveP3AService : public base::RefCountedThreadSafe<BraveP3AService>,
   void StartScheduledUpload();
 
   // Invoked by callbacks registered by our service. Since these callbacks
-  // can fire on any thread, this method reposts everything to UI thread.
-  void OnHistogramChanged(const char* histogram_name,
+  // can fire on any thread, this method only stores the latest bucket in
+  // |pending_buckets_| and leaves the rest to |DrainPendingBuckets()|.
+  void OnHistogramChanged(size_t histogram_index,
+                          const char* histogram_name,
                           uint64_t name_hash,
                           base::HistogramBase::Sample sample);
 
-  void OnHistogramChangedOnUI(const char* histogram_name,
-                              base::HistogramBase::Sample sample,
-                              size_t bucket);
+  // Stores |bucket| as the latest value of the histogram and makes sure a
+  // drain is scheduled on the UI thread. Safe to call from any thread.
+  void SetPendingBucket(size_t histogram_index, uint64_t bucket);
+
+  // Handles the latest bucket of every histogram that changed since the
+  // previous drain.
+  void DrainPendingBuckets();
+
+  void OnHistogramChangedOnUI(const char* histogram_name, size_t bucket);
 
   // Updates or removes a metric from the log.
   void HandleHistogramChange(base::StringPiece histogram_name, size_t bucket);
@@ -104,6 +118,8 @@ class BraveP3AService : public base::RefCountedThreadSafe<BraveP3AService>,
   // Interval between rotations, only used for testing from the command line.
   base::TimeDelta rotation_interval_;
   GURL upload_server_url_;
+  // Max number of P3A values per upload, only changed from the command line.
+  size_t upload_batch_size_ = 1u;
 
   prochlo::MessageMetainfo pyxis_meta_;
 
@@ -123,6 +139,13 @@ class BraveP3AService : public base::RefCountedThreadSafe<BraveP3AService>,
       std::unique_ptr<base::StatisticsRecorder::ScopedHistogramSampleObserver>>
       histogram_sample_callbacks_;
 
+  // Latest bucket per collected histogram that is not handled on UI thread
+  // yet, or |kNoPendingBucket|. Written from any thread without locking, so
+  // a burst of samples costs one UI task and one log store update per
+  // histogram instead of one per sample.
+  std::unique_ptr<std::atomic<uint64_t>[]> pending_buckets_;
+  std::atomic<bool> drain_scheduled_{false};
+
   DISALLOW_COPY_AND_ASSIGN(BraveP3AService);
 };
 
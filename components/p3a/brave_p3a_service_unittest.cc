@@ -0,0 +1,63 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/p3a/brave_p3a_service.h"
+
+#include <memory>
+
+#include "base/barrier_closure.h"
+#include "base/metrics/histogram_functions.h"
+#include "base/metrics/statistics_recorder.h"
+#include "base/run_loop.h"
+#include "base/task/thread_pool.h"
+#include "base/test/bind.h"
+#include "components/prefs/testing_pref_service.h"
+#include "content/public/test/browser_task_environment.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave {
+
+class BraveP3AServiceTest : public testing::Test {
+ protected:
+  content::BrowserTaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
+};
+
+TEST_F(BraveP3AServiceTest, CoalescesSamplesFromManyThreads) {
+  std::unique_ptr<base::StatisticsRecorder> recorder =
+      base::StatisticsRecorder::CreateTemporaryForTesting();
+  TestingPrefServiceSimple local_state;
+  BraveP3AService::RegisterPrefs(local_state.registry(), false);
+  auto service = base::MakeRefCounted<BraveP3AService>(&local_state, "release",
+                                                       "2021-01-04");
+  service->InitCallbacks();
+
+  constexpr int kThreadCount = 16;
+  constexpr int kSamplesPerThread = 200;
+  base::RunLoop run_loop;
+  base::RepeatingClosure barrier =
+      base::BarrierClosure(kThreadCount, run_loop.QuitClosure());
+  for (int i = 0; i < kThreadCount; ++i) {
+    base::ThreadPool::PostTask(FROM_HERE, base::BindLambdaForTesting([=]() {
+                                 for (int j = 0; j < kSamplesPerThread; ++j) {
+                                   base::UmaHistogramExactLinear(
+                                       "Brave.Core.TabCount", j % 5, 5);
+                                 }
+                                 barrier.Run();
+                               }));
+  }
+  run_loop.Run();
+
+  // Samples are only recorded in the slots until the drain runs.
+  task_environment_.FastForwardBy(base::TimeDelta::FromSeconds(1));
+  task_environment_.RunUntilIdle();
+
+  EXPECT_FALSE(service->drain_scheduled_.load());
+  ASSERT_EQ(service->histogram_values_.size(), 1u);
+  EXPECT_EQ(service->histogram_values_.begin()->first, "Brave.Core.TabCount");
+  EXPECT_LT(service->histogram_values_.begin()->second, 5u);
+}
+
+}  // namespace brave
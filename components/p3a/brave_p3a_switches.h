@@ -26,6 +26,11 @@ constexpr char kP3AUploadServerUrl[] = "p3a-upload-server-url";
 // continue the normal process.
 constexpr char kP3AIgnoreServerErrors[] = "p3a-ignore-server-errors";
 
+// Upload up to this many P3A values in one RawP3AValueBatch message instead of
+// one value per request. Values in a batch can be linked to each other, so
+// this is only meant for collectors that expect it.
+constexpr char kP3AUploadBatchSize[] = "p3a-upload-batch-size";
+
 }  // namespace switches
 }  // namespace brave
 
@@ -7,9 +7,12 @@
 
 #include <utility>
 
+#include "mojo/public/cpp/base/big_buffer.h"
 #include "mojo/public/cpp/bindings/interface_request.h"
 #include "mojo/public/cpp/bindings/sync_call_restrictions.h"
 #include "base/logging.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_piece.h"
 
 namespace bat_ads {
 
@@ -180,15 +183,20 @@ void BatAdsClientMojoBridge::Save(
       std::move(callback)));
 }
 
-void OnLoadAdsResource(const ads::LoadCallback& callback,
+void OnLoadAdsResource(const ads::LoadAdsResourceCallback& callback,
                        const int32_t result,
-                       const std::string& value) {
-  callback(ToAdsResult(result), value);
-}
-
-void BatAdsClientMojoBridge::LoadAdsResource(const std::string& id,
-                                             const int version,
-                                             ads::LoadCallback callback) {
+                       mojo_base::BigBuffer value) {
+  // Parse straight from the buffer, which is usually a shared memory mapping,
+  // rather than copying the resource into a string first
+  callback(ToAdsResult(result),
+      base::StringPiece(reinterpret_cast<const char*>(value.data()),
+                        value.size()));
+}
+
+void BatAdsClientMojoBridge::LoadAdsResource(
+    const std::string& id,
+    const int version,
+    ads::LoadAdsResourceCallback callback) {
   if (!connected()) {
     callback(ads::Result::FAILED, "");
     return;
@@ -293,6 +301,11 @@ void BatAdsClientMojoBridge::Log(
 
 bool BatAdsClientMojoBridge::GetBooleanPref(
     const std::string& path) const {
+  const base::Value* cached_value = GetCachedPref(path);
+  if (cached_value && cached_value->is_bool()) {
+    return cached_value->GetBool();
+  }
+
   bool value = false;
 
   if (!connected()) {
@@ -300,6 +313,7 @@ bool BatAdsClientMojoBridge::GetBooleanPref(
   }
 
   bat_ads_client_->GetBooleanPref(path, &value);
+  CachePref(path, base::Value(value));
   return value;
 }
 
@@ -310,11 +324,17 @@ void BatAdsClientMojoBridge::SetBooleanPref(
     return;
   }
 
+  CachePref(path, base::Value(value));
   bat_ads_client_->SetBooleanPref(path, value);
 }
 
 int BatAdsClientMojoBridge::GetIntegerPref(
     const std::string& path) const {
+  const base::Value* cached_value = GetCachedPref(path);
+  if (cached_value && cached_value->is_int()) {
+    return cached_value->GetInt();
+  }
+
   int value = 0;
 
   if (!connected()) {
@@ -322,6 +342,7 @@ int BatAdsClientMojoBridge::GetIntegerPref(
   }
 
   bat_ads_client_->GetIntegerPref(path, &value);
+  CachePref(path, base::Value(value));
   return value;
 }
 
@@ -332,11 +353,17 @@ void BatAdsClientMojoBridge::SetIntegerPref(
     return;
   }
 
+  CachePref(path, base::Value(value));
   bat_ads_client_->SetIntegerPref(path, value);
 }
 
 double BatAdsClientMojoBridge::GetDoublePref(
     const std::string& path) const {
+  const base::Value* cached_value = GetCachedPref(path);
+  if (cached_value && cached_value->is_double()) {
+    return cached_value->GetDouble();
+  }
+
   double value = 0.0;
 
   if (!connected()) {
@@ -344,6 +371,7 @@ double BatAdsClientMojoBridge::GetDoublePref(
   }
 
   bat_ads_client_->GetDoublePref(path, &value);
+  CachePref(path, base::Value(value));
   return value;
 }
 
@@ -354,11 +382,17 @@ void BatAdsClientMojoBridge::SetDoublePref(
     return;
   }
 
+  CachePref(path, base::Value(value));
   bat_ads_client_->SetDoublePref(path, value);
 }
 
 std::string BatAdsClientMojoBridge::GetStringPref(
     const std::string& path) const {
+  const base::Value* cached_value = GetCachedPref(path);
+  if (cached_value && cached_value->is_string()) {
+    return cached_value->GetString();
+  }
+
   std::string value;
 
   if (!connected()) {
@@ -366,6 +400,7 @@ std::string BatAdsClientMojoBridge::GetStringPref(
   }
 
   bat_ads_client_->GetStringPref(path, &value);
+  CachePref(path, base::Value(value));
   return value;
 }
 
@@ -376,6 +411,7 @@ void BatAdsClientMojoBridge::SetStringPref(
     return;
   }
 
+  CachePref(path, base::Value(value));
   bat_ads_client_->SetStringPref(path, value);
 }
 
@@ -383,11 +419,20 @@ int64_t BatAdsClientMojoBridge::GetInt64Pref(
     const std::string& path) const {
   int64_t value = 0;
 
+  const base::Value* cached_value = GetCachedPref(path);
+  if (cached_value && cached_value->is_string() &&
+      base::StringToInt64(cached_value->GetString(), &value)) {
+    return value;
+  }
+
+  value = 0;
+
   if (!connected()) {
     return value;
   }
 
   bat_ads_client_->GetInt64Pref(path, &value);
+  CachePref(path, base::Value(base::NumberToString(value)));
   return value;
 }
 
@@ -398,6 +443,7 @@ void BatAdsClientMojoBridge::SetInt64Pref(
     return;
   }
 
+  CachePref(path, base::Value(base::NumberToString(value)));
   bat_ads_client_->SetInt64Pref(path, value);
 }
 
@@ -405,11 +451,20 @@ uint64_t BatAdsClientMojoBridge::GetUint64Pref(
     const std::string& path) const {
   uint64_t value = 0;
 
+  const base::Value* cached_value = GetCachedPref(path);
+  if (cached_value && cached_value->is_string() &&
+      base::StringToUint64(cached_value->GetString(), &value)) {
+    return value;
+  }
+
+  value = 0;
+
   if (!connected()) {
     return value;
   }
 
   bat_ads_client_->GetUint64Pref(path, &value);
+  CachePref(path, base::Value(base::NumberToString(value)));
   return value;
 }
 
@@ -420,6 +475,7 @@ void BatAdsClientMojoBridge::SetUint64Pref(
     return;
   }
 
+  CachePref(path, base::Value(base::NumberToString(value)));
   bat_ads_client_->SetUint64Pref(path, value);
 }
 
@@ -429,13 +485,36 @@ void BatAdsClientMojoBridge::ClearPref(
     return;
   }
 
+  // The default value is only known to the browser, so fetch it on next read
+  pref_cache_.erase(path);
   bat_ads_client_->ClearPref(path);
 }
 
+void BatAdsClientMojoBridge::OnPrefChanged(
+    const std::string& path) {
+  pref_cache_.erase(path);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 bool BatAdsClientMojoBridge::connected() const {
   return bat_ads_client_.is_bound();
 }
 
+const base::Value* BatAdsClientMojoBridge::GetCachedPref(
+    const std::string& path) const {
+  const auto iter = pref_cache_.find(path);
+  if (iter == pref_cache_.end()) {
+    return nullptr;
+  }
+
+  return &iter->second;
+}
+
+void BatAdsClientMojoBridge::CachePref(
+    const std::string& path,
+    base::Value value) const {
+  pref_cache_[path] = std::move(value);
+}
+
 }  // namespace bat_ads
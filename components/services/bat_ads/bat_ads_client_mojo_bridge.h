@@ -10,6 +10,8 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/flat_map.h"
+#include "base/values.h"
 #include "bat/ads/ads_client.h"
 #include "brave/components/services/bat_ads/public/interfaces/bat_ads.mojom.h"
 #include "mojo/public/cpp/bindings/associated_remote.h"
@@ -59,7 +61,7 @@ class BatAdsClientMojoBridge
       ads::ResultCallback callback) override;
   void LoadAdsResource(const std::string& id,
                        const int version,
-                       ads::LoadCallback callback) override;
+                       ads::LoadAdsResourceCallback callback) override;
 
   void GetBrowsingHistory(const int max_count,
                           const int days_ago,
@@ -134,10 +136,27 @@ class BatAdsClientMojoBridge
   void ClearPref(
       const std::string& path) override;
 
+  // Drops the mirrored value for |path| so the next read fetches it from the
+  // browser. Called for every pref change the browser reports.
+  void OnPrefChanged(
+      const std::string& path);
+
  private:
   bool connected() const;
 
+  const base::Value* GetCachedPref(
+      const std::string& path) const;
+  void CachePref(
+      const std::string& path,
+      base::Value value) const;
+
   mojo::AssociatedRemote<mojom::BatAdsClient> bat_ads_client_;
+
+  // Mirror of the prefs read or written by ads, so repeated reads don't block
+  // on a sync IPC to the browser. Writes update the mirror before they are
+  // sent, so reads always see the utility process's own writes. Int64 and
+  // uint64 prefs are stored as strings, matching how the browser stores them.
+  mutable base::flat_map<std::string, base::Value> pref_cache_;
 };
 
 }  // namespace bat_ads
@@ -68,6 +68,7 @@ void BatAdsImpl::ChangeLocale(
 }
 
 void BatAdsImpl::OnPrefChanged(const std::string& path) {
+  bat_ads_client_mojo_proxy_->OnPrefChanged(path);
   ads_->OnPrefChanged(path);
 }
 
@@ -125,13 +125,14 @@ void AdsClientMojoBridge::Log(
 
 // static
 void AdsClientMojoBridge::OnLoadAdsResource(
-    CallbackHolder<LoadCallback>* holder,
+    CallbackHolder<LoadAdsResourceCallback>* holder,
     const ads::Result result,
-    const std::string& value) {
+    base::StringPiece value) {
   DCHECK(holder);
 
   if (holder->is_valid()) {
-    std::move(holder->get()).Run((int32_t)result, std::move(value));
+    std::move(holder->get()).Run((int32_t)result,
+        mojo_base::BigBuffer(base::as_bytes(base::make_span(value))));
   }
 
   delete holder;
@@ -139,10 +140,10 @@ void AdsClientMojoBridge::OnLoadAdsResource(
 
 void AdsClientMojoBridge::LoadAdsResource(const std::string& id,
                                           const int version,
-                                          LoadCallback callback) {
-  // this gets deleted in OnLoad
-  auto* holder =
-      new CallbackHolder<LoadCallback>(AsWeakPtr(), std::move(callback));
+                                          LoadAdsResourceCallback callback) {
+  // this gets deleted in OnLoadAdsResource
+  auto* holder = new CallbackHolder<LoadAdsResourceCallback>(
+      AsWeakPtr(), std::move(callback));
   ads_client_->LoadAdsResource(
       id, version,
       std::bind(AdsClientMojoBridge::OnLoadAdsResource, holder, _1, _2));
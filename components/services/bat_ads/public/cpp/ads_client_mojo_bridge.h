@@ -12,8 +12,10 @@
 #include <vector>
 
 #include "base/memory/weak_ptr.h"
+#include "base/strings/string_piece.h"
 #include "bat/ads/ads_client.h"
 #include "brave/components/services/bat_ads/public/interfaces/bat_ads.mojom.h"
+#include "mojo/public/cpp/base/big_buffer.h"
 #include "mojo/public/cpp/bindings/interface_request.h"
 
 namespace bat_ads {
@@ -64,7 +66,7 @@ class AdsClientMojoBridge
       const std::string& message) override;
   void LoadAdsResource(const std::string& id,
                        const int version,
-                       LoadCallback callback) override;
+                       LoadAdsResourceCallback callback) override;
 
   void GetBrowsingHistory(const int max_count,
                           const int days_ago,
@@ -165,9 +167,10 @@ class AdsClientMojoBridge
     Callback callback_;
   };
 
-  static void OnLoadAdsResource(CallbackHolder<LoadCallback>* holder,
-                                const ads::Result result,
-                                const std::string& value);
+  static void OnLoadAdsResource(
+      CallbackHolder<LoadAdsResourceCallback>* holder,
+      const ads::Result result,
+      base::StringPiece value);
 
   static void OnGetBrowsingHistory(
       CallbackHolder<GetBrowsingHistoryCallback>* holder,
@@ -5,6 +5,8 @@
 
 #include "brave/components/tor/tor_control.h"
 
+#include <algorithm>
+
 #include "base/sequenced_task_runner.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
@@ -700,24 +702,27 @@ void TorControl::ReadDone(int rv) {
   const char* data = readiobuf_->data();
   for (int i = 0; i < rv; i++) {
     if (!read_cr_) {
-      // No CR yet.  Accept CR or non-LF; reject LF.
-      if (data[i] == 0x0d) {  // CR
-        read_cr_ = true;
-      } else if (data[i] == 0x0a) {  // LF
+      // No CR yet.  Skip ahead to the next CR or LF; accept CR, reject LF.
+      const char* next = std::find_if(data + i, data + rv, [](char ch) {
+        return ch == 0x0d || ch == 0x0a;
+      });
+      if (next == data + rv)
+        break;
+      i = next - data;
+      if (data[i] == 0x0a) {  // LF
         VLOG(1) << "tor: stray line feed";
         Error();
         return;
-      } else {
-        // Anything else: Just accept it and move on.
       }
+      read_cr_ = true;
     } else {
       // CR seen.  Accept LF; reject all else.
       if (data[i] == 0x0a) {  // LF
-        // CRLF seen, so we must have i >= 2.  Emit a line and advance
-        // to the next one, unless anything went wrong with the line.
-        assert(i >= 1);
-        std::string line(readiobuf_->StartOfBuffer() + read_start_,
-                         readiobuf_->offset() + i - 1 - read_start_);
+        // CRLF seen.  Emit the line straight out of the buffer and
+        // advance to the next one, unless anything went wrong with the
+        // line.
+        base::StringPiece line(readiobuf_->StartOfBuffer() + read_start_,
+                               readiobuf_->offset() + i - 1 - read_start_);
         read_start_ = readiobuf_->offset() + i + 1;
         read_cr_ = false;
         if (!ReadLine(line)) {
@@ -773,7 +778,7 @@ void TorControl::ReadDone(int rv) {
 //      We have read a line of input; process it.  Return true on
 //      success, false on error.
 //
-bool TorControl::ReadLine(const std::string& line) {
+bool TorControl::ReadLine(base::StringPiece line) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(io_sequence_checker_);
 
   if (line.size() < 4) {
@@ -788,9 +793,12 @@ bool TorControl::ReadLine(const std::string& line) {
   // intermediate reply and ` ' for a final reply.
   //
   // TODO(riastradh): parse or check syntax of status
-  std::string status(line, 0, 3);
-  char pos = line[3];
-  std::string reply(line, 4);
+  //
+  // |line| points into the read buffer, so the pieces below are only
+  // copied once they are handed off.
+  const base::StringPiece status = line.substr(0, 3);
+  const char pos = line[3];
+  const base::StringPiece reply = line.substr(4);
 
   // Determine whether it is an asynchronous reply, status 6yz.
   if (status[0] == '6') {
@@ -801,13 +809,10 @@ bool TorControl::ReadLine(const std::string& line) {
     if (!async_) {
       // Parse the keyword and the initial line.
       const size_t sp = reply.find(' ');
-      std::string event_name, initial;
-      if (sp == std::string::npos) {
-        event_name = reply;
-      } else {
-        event_name = reply.substr(0, sp);
-        initial = reply.substr(sp + 1);
-      }
+      const std::string event_name(reply.substr(0, sp));
+      const base::StringPiece initial =
+          sp == base::StringPiece::npos ? base::StringPiece()
+                                        : reply.substr(sp + 1);
 
       // Discriminate on the position of the reply.
       switch (pos) {
@@ -830,7 +835,7 @@ bool TorControl::ReadLine(const std::string& line) {
 
           // Notify the delegate of the parsed reply.  No extra
           // because there were no intermediate reply lines.
-          NotifyTorEvent(event, initial, {});
+          NotifyTorEvent(event, std::string(initial), {});
 
           return true;
         }
@@ -845,7 +850,7 @@ bool TorControl::ReadLine(const std::string& line) {
                                                      : (*found).second);
           async_ = std::make_unique<Async>();
           async_->event = event;
-          async_->initial = initial;
+          async_->initial = std::string(initial);
           async_->skip = (event == TorControlEvent::INVALID);
           return true;
         }
@@ -873,12 +878,12 @@ bool TorControl::ReadLine(const std::string& line) {
             Error();
             return false;
           }
-          if (async_->extra.count(key)) {
+          if (!async_->extra.emplace(std::move(key), std::move(value))
+                   .second) {
             VLOG(1) << "tor: duplicate key in async continuation line";
             Error();
             return false;
           }
-          async_->extra[key] = value;
           return true;
         }
         case ' ': {
@@ -891,17 +896,18 @@ bool TorControl::ReadLine(const std::string& line) {
               Error();
               return false;
             }
-            if (async_->extra.count(key)) {
+            if (!async_->extra.emplace(std::move(key), std::move(value))
+                     .second) {
               VLOG(1) << "tor: duplicate key in async event";
               Error();
               return false;
             }
-            async_->extra[key] = value;
 
-            // If we're still subscribed, notify the delegate of the
-            // parsed reply.
+            // If we're still subscribed, hand the parsed reply over to
+            // the delegate.
             if (async_events_.count(async_->event)) {
-              NotifyTorEvent(async_->event, async_->initial, async_->extra);
+              NotifyTorEvent(async_->event, std::move(async_->initial),
+                             std::move(async_->extra));
             }
           }
           async_.reset();
@@ -917,7 +923,7 @@ bool TorControl::ReadLine(const std::string& line) {
         NotifyTorRawMid(status, reply);
         if (!cmdq_.empty()) {
           PerLineCallback& perline = cmdq_.front().first;
-          perline.Run(status, reply);
+          perline.Run(std::string(status), std::string(reply));
         }
         return true;
       case '+':
@@ -929,7 +935,8 @@ bool TorControl::ReadLine(const std::string& line) {
         if (!cmdq_.empty()) {
           CmdCallback& callback = cmdq_.front().second;
           bool error = false;
-          std::move(callback).Run(error, status, reply);
+          std::move(callback).Run(error, std::string(status),
+                                  std::string(reply));
           cmdq_.pop();
         }
         return true;
@@ -991,14 +998,13 @@ void TorControl::NotifyTorControlClosed() {
       base::BindOnce(&Delegate::OnTorControlClosed, delegate_, running_));
 }
 
-void TorControl::NotifyTorEvent(
-    TorControlEvent event,
-    const std::string& initial,
-    const std::map<std::string, std::string>& extra) {
+void TorControl::NotifyTorEvent(TorControlEvent event,
+                                std::string initial,
+                                std::map<std::string, std::string> extra) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(io_sequence_checker_);
   owner_task_runner_->PostTask(
-      FROM_HERE,
-      base::BindOnce(&Delegate::OnTorEvent, delegate_, event, initial, extra));
+      FROM_HERE, base::BindOnce(&Delegate::OnTorEvent, delegate_, event,
+                                std::move(initial), std::move(extra)));
 }
 
 void TorControl::NotifyTorRawCmd(const std::string& cmd) {
@@ -1007,28 +1013,31 @@ void TorControl::NotifyTorRawCmd(const std::string& cmd) {
       FROM_HERE, base::BindOnce(&Delegate::OnTorRawCmd, delegate_, cmd));
 }
 
-void TorControl::NotifyTorRawAsync(const std::string& status,
-                                   const std::string& line) {
+void TorControl::NotifyTorRawAsync(base::StringPiece status,
+                                   base::StringPiece line) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(io_sequence_checker_);
   owner_task_runner_->PostTask(
       FROM_HERE,
-      base::BindOnce(&Delegate::OnTorRawAsync, delegate_, status, line));
+      base::BindOnce(&Delegate::OnTorRawAsync, delegate_,
+                     std::string(status), std::string(line)));
 }
 
-void TorControl::NotifyTorRawMid(const std::string& status,
-                                 const std::string& line) {
+void TorControl::NotifyTorRawMid(base::StringPiece status,
+                                 base::StringPiece line) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(io_sequence_checker_);
   owner_task_runner_->PostTask(
       FROM_HERE,
-      base::BindOnce(&Delegate::OnTorRawMid, delegate_, status, line));
+      base::BindOnce(&Delegate::OnTorRawMid, delegate_,
+                     std::string(status), std::string(line)));
 }
 
-void TorControl::NotifyTorRawEnd(const std::string& status,
-                                 const std::string& line) {
+void TorControl::NotifyTorRawEnd(base::StringPiece status,
+                                 base::StringPiece line) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(io_sequence_checker_);
   owner_task_runner_->PostTask(
       FROM_HERE,
-      base::BindOnce(&Delegate::OnTorRawEnd, delegate_, status, line));
+      base::BindOnce(&Delegate::OnTorRawEnd, delegate_,
+                     std::string(status), std::string(line)));
 }
 
 // ParseKV(string, key, value)
@@ -1038,7 +1047,7 @@ void TorControl::NotifyTorRawEnd(const std::string& status,
 //      success, false on failure.
 //
 // static
-bool TorControl::ParseKV(const std::string& string,
+bool TorControl::ParseKV(base::StringPiece string,
                          std::string* key,
                          std::string* value) {
   size_t end;
@@ -1053,20 +1062,20 @@ bool TorControl::ParseKV(const std::string& string,
 //      failure.
 //
 // static
-bool TorControl::ParseKV(const std::string& string,
+bool TorControl::ParseKV(base::StringPiece string,
                          std::string* key,
                          std::string* value,
                          size_t* end) {
   DCHECK(key && value && end);
   // Search for `=' -- it had better be there.
-  size_t eq = string.find("=");
-  if (eq == std::string::npos)
+  size_t eq = string.find('=');
+  if (eq == base::StringPiece::npos)
     return false;
   size_t vstart = eq + 1;
 
   // If we're at the end of the string, value is empt.
   if (vstart == string.size()) {
-    *key = string.substr(0, eq);
+    *key = std::string(string.substr(0, eq));
     *value = "";
     *end = string.size();
     return true;
@@ -1076,7 +1085,7 @@ bool TorControl::ParseKV(const std::string& string,
   if (string[vstart] != '"') {
     // Not quoted.  Check for a delimiter.
     size_t i, vend = string.size();
-    if ((i = string.find(" ", vstart)) != std::string::npos) {
+    if ((i = string.find(' ', vstart)) != base::StringPiece::npos) {
       // Delimited.  Stop at the delimiter, and consume it.
       vend = i;
       *end = vend + 1;
@@ -1086,19 +1095,19 @@ bool TorControl::ParseKV(const std::string& string,
     }
 
     // Check for internal quotes; they are forbidden.
-    if ((i = string.find("\"", vstart)) != std::string::npos)
+    if ((i = string.find('"', vstart)) != base::StringPiece::npos)
       return false;
 
     // Extract the key and value and we're done.
-    *key = string.substr(0, eq);
-    *value = string.substr(vstart, vend - vstart);
+    *key = std::string(string.substr(0, eq));
+    *value = std::string(string.substr(vstart, vend - vstart));
     return true;
   }
 
   // Quoted string.  Parse it, and consume trailing spaces.
   if (!ParseQuoted(string.substr(eq + 1), value, end))
     return false;
-  *key = string.substr(0, eq);
+  *key = std::string(string.substr(0, eq));
   *end += eq + 1;
   while (*end < string.size() && string[*end] == ' ')
     (*end)++;
@@ -1113,7 +1122,7 @@ bool TorControl::ParseKV(const std::string& string,
 //      return false on failure.
 //
 // static
-bool TorControl::ParseQuoted(const std::string& string,
+bool TorControl::ParseQuoted(base::StringPiece string,
                              std::string* value,
                              size_t* end) {
   enum {
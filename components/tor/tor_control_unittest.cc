@@ -5,11 +5,15 @@
 
 #include "brave/components/tor/tor_control.h"
 
+#include <algorithm>
+#include <cstring>
+
 #include "base/callback_helpers.h"
 #include "base/run_loop.h"
 #include "content/public/browser/browser_task_traits.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/test/browser_task_environment.h"
+#include "net/base/io_buffer.h"
 #include "testing/gmock/include/gmock/gmock.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -184,6 +188,66 @@ TEST(TorControlTest, ReadLine) {
   base::RunLoop().RunUntilIdle();
 }
 
+TEST(TorControlTest, ReadDone) {
+  content::BrowserTaskEnvironment task_environment;
+  scoped_refptr<base::SequencedTaskRunner> io_task_runner =
+      content::GetIOThreadTaskRunner({});
+
+  MockTorControlDelegate delegate;
+  std::unique_ptr<TorControl> control =
+      std::make_unique<TorControl>(delegate.AsWeakPtr(), io_task_runner);
+
+  using tor::TorControlEvent;
+  EXPECT_CALL(delegate, OnTorRawAsync("650", testing::_)).Times(4);
+  EXPECT_CALL(delegate, OnTorEvent(TorControlEvent::STATUS_CLIENT,
+                                   "NOTICE CIRCUIT_ESTABLISHED", testing::_))
+      .Times(1);
+  std::map<std::string, std::string> circ_extra = {
+      {"BUILD_FLAGS", "NEED_CAPACITY"}, {"PURPOSE", "GENERAL"}};
+  EXPECT_CALL(delegate,
+              OnTorEvent(TorControlEvent::CIRC, "5 LAUNCHED", circ_extra))
+      .Times(1);
+  EXPECT_CALL(delegate, OnTorControlClosed(false)).Times(1);
+  io_task_runner->PostTask(
+      FROM_HERE,
+      base::BindOnce(
+          [](std::unique_ptr<TorControl> control) {
+            // Emulate subscribe
+            control->async_events_[TorControlEvent::STATUS_CLIENT] = 1;
+            control->async_events_[TorControlEvent::CIRC] = 1;
+            control->reading_ = true;
+            control->StartRead();
+
+            // Feed the transcript in small reads, so that lines and CRLFs
+            // are split between them.
+            const std::string transcript =
+                "650 STATUS_CLIENT NOTICE CIRCUIT_ESTABLISHED\r\n"
+                "650-CIRC 5 LAUNCHED\r\n"
+                "650-BUILD_FLAGS=NEED_CAPACITY\r\n"
+                "650 PURPOSE=GENERAL\r\n";
+            constexpr size_t kReadSize = 7;
+            for (size_t i = 0; i < transcript.size(); i += kReadSize) {
+              const size_t size = std::min(kReadSize, transcript.size() - i);
+              memcpy(control->readiobuf_->data(), transcript.data() + i,
+                     size);
+              control->ReadDone(size);
+              ASSERT_TRUE(control->reading_);
+            }
+            EXPECT_EQ(control->read_start_, control->readiobuf_->offset());
+            EXPECT_FALSE(control->async_);
+
+            // A line feed without a carriage return is an error.
+            const char kStrayLineFeed[] = "650 CIRC 5 CLOSED\n";
+            memcpy(control->readiobuf_->data(), kStrayLineFeed,
+                   strlen(kStrayLineFeed));
+            control->ReadDone(strlen(kStrayLineFeed));
+            EXPECT_FALSE(control->reading_);
+          },
+          std::move(control)));
+
+  base::RunLoop().RunUntilIdle();
+}
+
 TEST(TorControlTest, GetCircuitEstablishedDone) {
   content::BrowserTaskEnvironment task_environment;
   scoped_refptr<base::SequencedTaskRunner> io_task_runner =
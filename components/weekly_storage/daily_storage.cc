@@ -5,7 +5,7 @@
 
 #include "brave/components/weekly_storage/daily_storage.h"
 
-#include <numeric>
+#include <algorithm>
 #include <utility>
 
 #include "base/logging.h"
@@ -16,6 +16,17 @@
 #include "components/prefs/pref_service.h"
 #include "components/prefs/scoped_user_pref_update.h"
 
+namespace {
+
+void AppendDailyValue(base::ListValue* list, base::Time time, uint64_t value) {
+  base::DictionaryValue daily_value;
+  daily_value.SetKey("day", base::Value(time.ToDoubleT()));
+  daily_value.SetDoubleKey("value", value);
+  list->Append(std::move(daily_value));
+}
+
+}  // namespace
+
 DailyStorage::DailyStorage(PrefService* prefs, const char* pref_name)
     : prefs_(prefs),
       pref_name_(pref_name),
@@ -38,25 +49,27 @@ DailyStorage::DailyStorage(PrefService* prefs,
 DailyStorage::~DailyStorage() = default;
 
 void DailyStorage::RecordValueNow(uint64_t delta) {
-  daily_values_.push_front({clock_->Now(), delta});
-  Save();
+  const size_t expired_count = FilterToDay();
+  daily_values_.push_back({clock_->Now(), delta});
+  sum_ += delta;
+  Save(expired_count);
 }
 
 uint64_t DailyStorage::GetLast24HourSum() const {
   // We record only value for last N days.
-  return std::accumulate(daily_values_.begin(), daily_values_.end(), 0ull,
-                         [](const uint64_t acc, const DailyValue& item) {
-                           return acc + item.value;
-                         });
+  return sum_;
 }
 
-void DailyStorage::FilterToDay() {
-  if (daily_values_.empty()) {
-    return;
-  }
+size_t DailyStorage::FilterToDay() {
   // Remove all values that aren't within the last 24 hours
   base::Time min = clock_->Now() - base::TimeDelta::FromDays(1);
-  daily_values_.remove_if([min](DailyValue val) { return (val.time <= min); });
+  size_t expired_count = 0;
+  while (!daily_values_.empty() && daily_values_.front().time <= min) {
+    sum_ -= daily_values_.front().value;
+    daily_values_.pop_front();
+    ++expired_count;
+  }
+  return expired_count;
 }
 
 void DailyStorage::Load() {
@@ -71,26 +84,47 @@ void DailyStorage::Load() {
     const base::Value* value = it.FindKey("value");
     // Validate correct data format
     if (!day || !value || !day->is_double() || !value->is_double()) {
+      needs_full_save_ = true;
       continue;
     }
     // Disregard if old value
     auto time = base::Time::FromDoubleT(day->GetDouble());
     if (time <= min) {
+      needs_full_save_ = true;
       continue;
     }
     daily_values_.push_back({time, static_cast<uint64_t>(value->GetDouble())});
+    sum_ += daily_values_.back().value;
+  }
+  // Older versions stored the most recent value first.
+  const auto by_time = [](const DailyValue& left, const DailyValue& right) {
+    return left.time < right.time;
+  };
+  if (!std::is_sorted(daily_values_.begin(), daily_values_.end(), by_time)) {
+    std::stable_sort(daily_values_.begin(), daily_values_.end(), by_time);
+    needs_full_save_ = true;
   }
 }
 
-void DailyStorage::Save() {
-  FilterToDay();
+void DailyStorage::Save(size_t expired_count) {
+  DCHECK(!daily_values_.empty());
   ListPrefUpdate update(prefs_, pref_name_);
   base::ListValue* list = update.Get();
-  list->Clear();
+  // Unless something else touched it, the stored list holds the values that
+  // just expired and everything recorded before the new value.
+  if (!needs_full_save_ &&
+      list->GetList().size() + 1 == daily_values_.size() + expired_count) {
+    for (size_t i = 0; i < expired_count; ++i) {
+      list->EraseListIter(list->GetList().begin());
+    }
+    AppendDailyValue(list, daily_values_.back().time,
+                     daily_values_.back().value);
+    return;
+  }
+
+  list->ClearList();
   for (const auto& u : daily_values_) {
-    base::DictionaryValue value;
-    value.SetKey("day", base::Value(u.time.ToDoubleT()));
-    value.SetDoubleKey("value", u.value);
-    list->Append(std::move(value));
+    AppendDailyValue(list, u.time, u.value);
   }
+  needs_full_save_ = false;
 }
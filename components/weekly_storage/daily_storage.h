@@ -6,9 +6,9 @@
 #ifndef BRAVE_COMPONENTS_WEEKLY_STORAGE_DAILY_STORAGE_H_
 #define BRAVE_COMPONENTS_WEEKLY_STORAGE_DAILY_STORAGE_H_
 
-#include <list>
 #include <memory>
 
+#include "base/containers/circular_deque.h"
 #include "base/time/time.h"
 
 namespace base {
@@ -41,15 +41,22 @@ class DailyStorage {
     base::Time time;
     uint64_t value = 0ull;
   };
-  void FilterToDay();
+  // Drops values older than 24 hours and returns how many were dropped.
+  size_t FilterToDay();
   void Load();
-  void Save();
+  void Save(size_t expired_count);
 
   PrefService* prefs_ = nullptr;
   const char* pref_name_ = nullptr;
   std::unique_ptr<base::Clock> clock_;
 
-  std::list<DailyValue> daily_values_;
+  // Ordered from the oldest to the most recent value.
+  base::circular_deque<DailyValue> daily_values_;
+  // Sum of all values currently held in |daily_values_|.
+  uint64_t sum_ = 0;
+  // Set when the stored list no longer mirrors |daily_values_| entry by
+  // entry. Otherwise values are appended and expired from the stored list.
+  bool needs_full_save_ = false;
 };
 
 #endif  // BRAVE_COMPONENTS_WEEKLY_STORAGE_DAILY_STORAGE_H_
@@ -10,14 +10,16 @@
 
 #include "base/test/simple_test_clock.h"
 #include "base/time/time.h"
+#include "base/values.h"
 #include "components/prefs/pref_registry_simple.h"
 #include "components/prefs/testing_pref_service.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
+constexpr char kPrefName[] = "brave.daily_test";
+
 class DailyStorageTest : public ::testing::Test {
  public:
   DailyStorageTest() : clock_(new base::SimpleTestClock) {
-    constexpr char kPrefName[] = "brave.daily_test";
     pref_service_.registry()->RegisterListPref(kPrefName);
 
     state_ = std::make_unique<DailyStorage>(
@@ -96,3 +98,31 @@ TEST_F(DailyStorageTest, InfrequentUsage) {
   state_->RecordValueNow(value);
   EXPECT_EQ(state_->GetLast24HourSum(), 2 * value);
 }
+
+TEST_F(DailyStorageTest, LoadsMostRecentFirstList) {
+  const base::Time now = clock_->Now();
+  base::ListValue list;
+  for (int hours_ago : {1, 5, 30}) {
+    base::DictionaryValue value;
+    value.SetKey(
+        "day",
+        base::Value((now - base::TimeDelta::FromHours(hours_ago)).ToDoubleT()));
+    value.SetDoubleKey("value", 10);
+    list.Append(std::move(value));
+  }
+  pref_service_.Set(kPrefName, list);
+
+  auto clock = std::make_unique<base::SimpleTestClock>();
+  clock->SetNow(now);
+  DailyStorage reloaded(&pref_service_, kPrefName, std::move(clock));
+  EXPECT_EQ(reloaded.GetLast24HourSum(), 20u);
+
+  reloaded.RecordValueNow(10);
+  EXPECT_EQ(reloaded.GetLast24HourSum(), 30u);
+  const base::ListValue* stored = pref_service_.GetList(kPrefName);
+  ASSERT_EQ(stored->GetList().size(), 3u);
+  // Rewritten from the oldest to the most recent value.
+  EXPECT_EQ(stored->GetList()[0].FindKey("day")->GetDouble(),
+            (now - base::TimeDelta::FromHours(5)).ToDoubleT());
+  EXPECT_EQ(stored->GetList()[2].FindKey("day")->GetDouble(), now.ToDoubleT());
+}
@@ -5,7 +5,7 @@
 
 #include "brave/components/weekly_storage/weekly_storage.h"
 
-#include <numeric>
+#include <algorithm>
 #include <utility>
 
 #include "base/time/clock.h"
@@ -14,9 +14,7 @@
 #include "components/prefs/pref_service.h"
 #include "components/prefs/scoped_user_pref_update.h"
 
-namespace {
-constexpr size_t kDaysInWeek = 7;
-}
+constexpr size_t WeeklyStorage::kDaysInWeek;
 
 WeeklyStorage::WeeklyStorage(PrefService* prefs, const char* pref_name)
     : prefs_(prefs),
@@ -41,113 +39,134 @@ WeeklyStorage::~WeeklyStorage() = default;
 
 void WeeklyStorage::AddDelta(uint64_t delta) {
   FilterToWeek();
-  daily_values_.front().value += delta;
+  if (delta == 0 && !needs_full_save_) {
+    return;
+  }
+  Today().value += delta;
+  sum_ += delta;
   Save();
 }
 
 void WeeklyStorage::ReplaceTodaysValueIfGreater(uint64_t value) {
   FilterToWeek();
-  DailyValue& today = daily_values_.front();
+  DailyValue& today = Today();
   if (today.value < value) {
+    sum_ += value - today.value;
     today.value = value;
+  } else if (!needs_full_save_) {
+    return;
   }
   Save();
 }
 
 uint64_t WeeklyStorage::GetWeeklySum() const {
-  // We record only value for last N days.
+  // We record only value for last N days. Days that went out of the window
+  // since the last write are the oldest ones, so drop them from the end.
   const base::Time n_days_ago =
       clock_->Now() - base::TimeDelta::FromDays(kDaysInWeek);
-  return std::accumulate(daily_values_.begin(), daily_values_.end(), 0ull,
-                         [n_days_ago](const uint64_t acc, const auto& u2) {
-                           uint64_t add = 0;
-                           // Check only last continious days.
-                           if (u2.day > n_days_ago) {
-                             add = u2.value;
-                           }
-                           return acc + add;
-                         });
+  uint64_t sum = sum_;
+  for (size_t age = size_; age > 0 && GetDay(age - 1).day <= n_days_ago;
+       --age) {
+    sum -= GetDay(age - 1).value;
+  }
+  return sum;
 }
 
 uint64_t WeeklyStorage::GetHighestValueInWeek() const {
   // We record only value for last N days.
   const base::Time n_days_ago =
       clock_->Now() - base::TimeDelta::FromDays(kDaysInWeek);
-  std::list<DailyValue> last_weeks_daily_values(daily_values_.size());
-  auto copied_it =
-      std::copy_if(daily_values_.begin(), daily_values_.end(),
-                   last_weeks_daily_values.begin(),
-                   [n_days_ago](auto i) { return i.day > n_days_ago; });
-  last_weeks_daily_values.resize(
-      std::distance(last_weeks_daily_values.begin(), copied_it));
-
-  auto highest_it = std::max_element(last_weeks_daily_values.begin(),
-                                     last_weeks_daily_values.end(),
-                                     [](const auto& left, const auto& right) {
-                                       return left.value < right.value;
-                                     });
-  if (highest_it == last_weeks_daily_values.end()) {
-    return 0;
+  uint64_t highest = 0;
+  for (size_t age = 0; age < size_ && GetDay(age).day > n_days_ago; ++age) {
+    highest = std::max(highest, GetDay(age).value);
   }
-  return highest_it->value;
+  return highest;
 }
 
 bool WeeklyStorage::IsOneWeekPassed() const {
   // TODO(iefremov): This is not true 100% (if the browser was launched once
   // per week just after installation, for example).
-  return daily_values_.size() == kDaysInWeek;
+  return size_ == kDaysInWeek;
+}
+
+const WeeklyStorage::DailyValue& WeeklyStorage::GetDay(size_t age) const {
+  DCHECK_LT(age, size_);
+  return daily_values_[(head_ + age) % kDaysInWeek];
+}
+
+WeeklyStorage::DailyValue& WeeklyStorage::Today() {
+  DCHECK_GT(size_, 0u);
+  return daily_values_[head_];
 }
 
 void WeeklyStorage::FilterToWeek() {
   base::Time now_midnight = clock_->Now().LocalMidnight();
   base::Time last_saved_midnight;
 
-  if (!daily_values_.empty()) {
-    last_saved_midnight = daily_values_.front().day;
+  if (size_ > 0) {
+    last_saved_midnight = Today().day;
   }
 
   if (now_midnight - last_saved_midnight > base::TimeDelta()) {
     // Day changed. Since we consider only small incoming intervals, lets just
-    // save it with a new timestamp.
-    daily_values_.push_front({now_midnight, 0});
-    if (daily_values_.size() > kDaysInWeek) {
-      daily_values_.pop_back();
+    // save it with a new timestamp, overwriting the oldest day if needed.
+    head_ = (head_ + kDaysInWeek - 1) % kDaysInWeek;
+    if (size_ == kDaysInWeek) {
+      sum_ -= daily_values_[head_].value;
+    } else {
+      ++size_;
     }
+    daily_values_[head_] = {now_midnight, 0};
+    needs_full_save_ = true;
   }
 }
 
 void WeeklyStorage::Load() {
-  DCHECK(daily_values_.empty());
+  DCHECK_EQ(size_, 0u);
   const base::ListValue* list = prefs_->GetList(pref_name_);
   if (!list) {
     return;
   }
+  // Stored newest first, so fill the ring buffer in the same order.
   for (auto& it : list->GetList()) {
     const base::Value* day = it.FindKey("day");
     const base::Value* value = it.FindKey("value");
     if (!day || !value || !day->is_double() || !value->is_double()) {
+      needs_full_save_ = true;
       continue;
     }
-    if (daily_values_.size() == kDaysInWeek) {
+    if (size_ == kDaysInWeek) {
+      needs_full_save_ = true;
       break;
     }
-    daily_values_.push_back({base::Time::FromDoubleT(day->GetDouble()),
-                             static_cast<uint64_t>(value->GetDouble())});
+    DailyValue& daily_value = daily_values_[size_++];
+    daily_value.day = base::Time::FromDoubleT(day->GetDouble());
+    daily_value.value = static_cast<uint64_t>(value->GetDouble());
+    sum_ += daily_value.value;
   }
 }
 
 void WeeklyStorage::Save() {
-  DCHECK(!daily_values_.empty());
-  DCHECK_LE(daily_values_.size(), kDaysInWeek);
+  DCHECK_GT(size_, 0u);
+  DCHECK_LE(size_, kDaysInWeek);
 
   ListPrefUpdate update(prefs_, pref_name_);
   base::ListValue* list = update.Get();
-  // TODO(iefremov): Optimize if needed.
-  list->Clear();
-  for (const auto& u : daily_values_) {
+  base::Value::ListView stored_values = list->GetList();
+  if (!needs_full_save_ && stored_values.size() == size_ &&
+      stored_values[0].is_dict()) {
+    // Same days as in the stored list, only today's value may differ.
+    stored_values[0].SetDoubleKey("value", Today().value);
+    return;
+  }
+
+  list->ClearList();
+  for (size_t age = 0; age < size_; ++age) {
+    const DailyValue& u = GetDay(age);
     base::DictionaryValue value;
     value.SetKey("day", base::Value(u.day.ToDoubleT()));
     value.SetDoubleKey("value", u.value);
     list->Append(std::move(value));
   }
+  needs_full_save_ = false;
 }
@@ -6,7 +6,7 @@
 #ifndef BRAVE_COMPONENTS_WEEKLY_STORAGE_WEEKLY_STORAGE_H_
 #define BRAVE_COMPONENTS_WEEKLY_STORAGE_WEEKLY_STORAGE_H_
 
-#include <list>
+#include <array>
 #include <memory>
 
 #include "base/time/time.h"
@@ -42,10 +42,17 @@ class WeeklyStorage {
   bool IsOneWeekPassed() const;
 
  private:
+  static constexpr size_t kDaysInWeek = 7;
+
   struct DailyValue {
     base::Time day;
     uint64_t value = 0ull;
   };
+
+  // Returns the value recorded |age| days before the most recent one.
+  const DailyValue& GetDay(size_t age) const;
+  DailyValue& Today();
+
   void FilterToWeek();
   void Load();
   void Save();
@@ -54,7 +61,15 @@ class WeeklyStorage {
   const char* pref_name_ = nullptr;
   std::unique_ptr<base::Clock> clock_;
 
-  std::list<DailyValue> daily_values_;
+  // Ring buffer of the last |kDaysInWeek| days, |head_| is the most recent.
+  std::array<DailyValue, kDaysInWeek> daily_values_;
+  size_t head_ = 0;
+  size_t size_ = 0;
+  // Sum of all values currently held in |daily_values_|.
+  uint64_t sum_ = 0;
+  // Set when the stored list no longer mirrors |daily_values_| entry by
+  // entry, e.g. after a day change. Otherwise only today's entry is updated.
+  bool needs_full_save_ = false;
 };
 
 #endif  // BRAVE_COMPONENTS_WEEKLY_STORAGE_WEEKLY_STORAGE_H_
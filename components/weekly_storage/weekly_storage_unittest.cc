@@ -14,10 +14,11 @@
 #include "components/prefs/testing_pref_service.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
+constexpr char kPrefName[] = "brave.weekly_test";
+
 class WeeklyStorageTest : public ::testing::Test {
  public:
   WeeklyStorageTest() : clock_(new base::SimpleTestClock) {
-    constexpr char kPrefName[] = "brave.weekly_test";
     pref_service_.registry()->RegisterListPref(kPrefName);
 
     state_ = std::make_unique<WeeklyStorage>(
@@ -138,3 +139,20 @@ TEST_F(WeeklyStorageTest, GetsHighestValueInWeekFromReplacement) {
   // Sanity check disparate days were not replaced
   EXPECT_EQ(state_->GetWeeklySum(), high_value + low_value);
 }
+
+TEST_F(WeeklyStorageTest, PersistsAcrossInstances) {
+  uint64_t saving = 10000;
+  for (int day = 0; day < 9; day++) {
+    clock_->Advance(base::TimeDelta::FromDays(1));
+    state_->AddDelta(saving);
+    state_->AddDelta(saving);
+  }
+  EXPECT_EQ(pref_service_.GetList(kPrefName)->GetList().size(), 7u);
+
+  auto clock = std::make_unique<base::SimpleTestClock>();
+  clock->SetNow(clock_->Now());
+  WeeklyStorage reloaded(&pref_service_, kPrefName, std::move(clock));
+  EXPECT_EQ(reloaded.GetWeeklySum(), 14 * saving);
+  EXPECT_EQ(reloaded.GetHighestValueInWeek(), 2 * saving);
+  EXPECT_TRUE(reloaded.IsOneWeekPassed());
+}
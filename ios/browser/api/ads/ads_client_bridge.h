@@ -22,7 +22,7 @@
 - (bool)shouldShowNotifications;
 - (void)loadAdsResource:(const std::string&)id
                 version:(const int)version
-               callback:(ads::LoadCallback)callback;
+               callback:(ads::LoadAdsResourceCallback)callback;
 - (void)getBrowsingHistory:(const int)max_count
                    forDays:(const int)days_ago
                   callback:(ads::GetBrowsingHistoryCallback)callback;
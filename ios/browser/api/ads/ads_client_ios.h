@@ -43,7 +43,7 @@ class AdsClientIOS : public ads::AdsClient {
   void Load(const std::string& name, ads::LoadCallback callback) override;
   void LoadAdsResource(const std::string& id,
                        const int version,
-                       ads::LoadCallback callback) override;
+                       ads::LoadAdsResourceCallback callback) override;
   void GetBrowsingHistory(const int max_count,
                           const int days_ago,
                           ads::GetBrowsingHistoryCallback callback) override;
@@ -76,7 +76,7 @@ void AdsClientIOS::Save(const std::string& name,
 
 void AdsClientIOS::LoadAdsResource(const std::string& id,
                                    const int version,
-                                   ads::LoadCallback callback) {
+                                   ads::LoadAdsResourceCallback callback) {
   [bridge_ loadAdsResource:id version:version callback:callback];
 }
 
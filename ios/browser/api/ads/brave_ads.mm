@@ -1128,7 +1128,7 @@ BATClassAdsBridge(BOOL, isDebug, setDebug, g_is_debug)
 
 - (void)loadAdsResource:(const std::string&)id
                 version:(const int)version
-               callback:(ads::LoadCallback)callback {
+               callback:(ads::LoadAdsResourceCallback)callback {
   NSString* bridgedId = base::SysUTF8ToNSString(id);
 
   BLOG(1, @"Loading %@ ads resource", bridgedId);
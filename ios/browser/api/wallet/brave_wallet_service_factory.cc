@@ -5,9 +5,14 @@
 
 #include "brave/ios/browser/api/wallet/brave_wallet_service_factory.h"
 
+#include <utility>
+
+#include "base/memory/scoped_refptr.h"
+#include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_service.h"
 #include "brave/components/brave_wallet/browser/pref_names.h"
 #include "components/keyed_service/ios/browser_state_dependency_manager.h"
+#include "components/prefs/json_pref_store.h"
 #include "ios/chrome/browser/browser_state/browser_state_otr_helper.h"
 #include "ios/chrome/browser/browser_state/chrome_browser_state.h"
 #include "services/network/public/cpp/shared_url_loader_factory.h"
@@ -35,9 +40,12 @@ std::unique_ptr<KeyedService>
 BraveWalletServiceFactory::BuildServiceInstanceFor(
     web::BrowserState* context) const {
   auto* browser_state = ChromeBrowserState::FromBrowserState(context);
+  auto tx_store = base::MakeRefCounted<JsonPrefStore>(
+      browser_state->GetStatePath().AppendASCII(
+          brave_wallet::kTransactionsFileName));
   std::unique_ptr<brave_wallet::BraveWalletService> wallet_service(
       new brave_wallet::BraveWalletService(
-          browser_state->GetPrefs(),
+          browser_state->GetPrefs(), std::move(tx_store),
           browser_state->GetSharedURLLoaderFactory()));
   return wallet_service;
 }